@@ -0,0 +1,218 @@
+/**
+ ********************************************************************************
+ * @file    DataStructures_Benchmark.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Host Benchmark of the DataStructures Containers Against std Containers
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <deque>
+#include <list>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <List.tpp>
+#include <PriorityQueue.tpp>
+#include <Queue.tpp>
+#include <SPSCQueue.tpp>
+#include <StaticQueue.tpp>
+
+namespace {
+
+const unsigned int CAPACITY = 4096;
+const unsigned int COUNTS[] = {16, 256, CAPACITY};
+const unsigned long long TARGET_OPS = 2000000ULL;
+
+volatile uint64_t Sink = 0;
+
+template<unsigned int BYTES>
+struct Element {
+    uint32_t key;
+    uint8_t payload[BYTES - sizeof(uint32_t)];
+
+    Element() : key(0) {}
+    Element(uint32_t key) : key(key) { memset(payload, (uint8_t)key, sizeof(payload)); }
+};
+
+// Scrambles insertion order so the heaps do real sifting
+template<typename T>
+struct KeyOrder {
+    inline bool operator()(const T &a, const T &b) const { return (a.key * 2654435761u) < (b.key * 2654435761u); }
+};
+
+// std::priority_queue is a max-heap, so it gets the comparison reversed
+template<typename T>
+struct ReverseKeyOrder {
+    inline bool operator()(const T &a, const T &b) const { return KeyOrder<T>()(b, a); }
+};
+
+// Sequence access shared by everything with push_back/pop_front (std::deque, std::list)
+template<typename C, typename T>
+struct Adapter {
+    static inline void Push(C &c, const T &value) { c.push_back(value); }
+    static inline T Pop(C &c) {
+        T value(std::move(c.front()));
+        c.pop_front();
+        return value;
+    }
+};
+
+template<typename T, typename A>
+struct Adapter<DataStructures::List<T, A>, T> {
+    static inline void Push(DataStructures::List<T, A> &c, const T &value) { c.push_back(value); }
+    static inline T Pop(DataStructures::List<T, A> &c) { return c.pop_front(); }
+};
+
+template<typename T, typename A>
+struct Adapter<DataStructures::Queue<T, A>, T> {
+    static inline void Push(DataStructures::Queue<T, A> &c, const T &value) { c.push(value); }
+    static inline T Pop(DataStructures::Queue<T, A> &c) { return c.pop(); }
+};
+
+template<typename T, DataStructures::QueueSize_t N>
+struct Adapter<DataStructures::StaticQueue<T, N>, T> {
+    static inline void Push(DataStructures::StaticQueue<T, N> &c, const T &value) { c.push(value); }
+    static inline T Pop(DataStructures::StaticQueue<T, N> &c) { return c.pop(); }
+};
+
+template<typename T, DataStructures::QueueSize_t N>
+struct Adapter<DataStructures::SPSCQueue<T, N>, T> {
+    static inline void Push(DataStructures::SPSCQueue<T, N> &c, const T &value) { c.push(value); }
+    static inline T Pop(DataStructures::SPSCQueue<T, N> &c) { return c.pop(); }
+};
+
+template<typename T, typename Compare, DataStructures::PriorityQueueSize_t N>
+struct Adapter<DataStructures::PriorityQueue<T, Compare, N>, T> {
+    static inline void Push(DataStructures::PriorityQueue<T, Compare, N> &c, const T &value) { c.push(value); }
+    static inline T Pop(DataStructures::PriorityQueue<T, Compare, N> &c) { return c.pop(); }
+};
+
+template<typename T, typename Compare>
+struct Adapter<std::priority_queue<T, std::vector<T>, Compare>, T> {
+    static inline void Push(std::priority_queue<T, std::vector<T>, Compare> &c, const T &value) { c.push(value); }
+    static inline T Pop(std::priority_queue<T, std::vector<T>, Compare> &c) {
+        T value(c.top());
+        c.pop();
+        return value;
+    }
+};
+
+unsigned long long Rounds(unsigned long long ops_per_round) {
+    unsigned long long rounds = TARGET_OPS / ops_per_round;
+    return (rounds == 0) ? 1 : rounds;
+}
+
+void Report(const char *container, unsigned int bytes, unsigned int count, const char *operation,
+            unsigned long long ops, std::chrono::steady_clock::time_point start) {
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("%s,%u,%u,%s,%llu,%.2f\n", container, bytes, count, operation, ops, ns / ops);
+}
+
+// Fill to count, then drain, repeatedly
+template<typename C, typename T>
+void BenchmarkFifo(const char *name, unsigned int count) {
+    C *c = new C();
+    unsigned long long rounds = Rounds(2ULL * count);
+    uint64_t sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long round = 0; round < rounds; round++) {
+        for (unsigned int i = 0; i < count; i++) Adapter<C, T>::Push(*c, T(i));
+        for (unsigned int i = 0; i < count; i++) sum += Adapter<C, T>::Pop(*c).key;
+    }
+    Report(name, sizeof(T), count, "push_pop", rounds * 2ULL * count, start);
+
+    Sink += sum;
+    delete c;
+}
+
+template<typename C, typename T>
+void BenchmarkIterate(const char *name, unsigned int count) {
+    C *c = new C();
+    for (unsigned int i = 0; i < count; i++) c->push_back(T(i));
+    unsigned long long rounds = Rounds(count);
+    uint64_t sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long round = 0; round < rounds; round++) {
+        for (const T &element : *c) sum += element.key;
+    }
+    Report(name, sizeof(T), count, "iterate", rounds * count, start);
+
+    Sink += sum;
+    delete c;
+}
+
+// Linked lists pay O(n) per index, so they run proportionally fewer rounds
+template<typename C, typename T>
+void BenchmarkRandomAccess(const char *name, unsigned int count, bool linear_index) {
+    C *c = new C();
+    for (unsigned int i = 0; i < count; i++) c->push_back(T(i));
+    std::vector<unsigned int> indices(count);
+    uint32_t state = 0x2545F491;
+    for (unsigned int i = 0; i < count; i++) {
+        state = state * 1664525u + 1013904223u;
+        indices[i] = state % count;
+    }
+    unsigned long long rounds = Rounds(linear_index ? (unsigned long long)count * count / 2 : count);
+    uint64_t sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long round = 0; round < rounds; round++) {
+        for (unsigned int i = 0; i < count; i++) sum += (*c)[indices[i]].key;
+    }
+    Report(name, sizeof(T), count, "random_access", rounds * count, start);
+
+    Sink += sum;
+    delete c;
+}
+
+template<unsigned int BYTES>
+void RunElement() {
+    using T = Element<BYTES>;
+
+    for (unsigned int count : COUNTS) {
+        BenchmarkFifo<DataStructures::List<T>, T>("List", count);
+        BenchmarkFifo<DataStructures::PooledList<T, CAPACITY>, T>("PooledList", count);
+        BenchmarkFifo<DataStructures::Queue<T>, T>("Queue", count);
+        BenchmarkFifo<DataStructures::PooledQueue<T, CAPACITY>, T>("PooledQueue", count);
+        BenchmarkFifo<DataStructures::StaticQueue<T, CAPACITY>, T>("StaticQueue", count);
+        BenchmarkFifo<DataStructures::SPSCQueue<T, CAPACITY>, T>("SPSCQueue", count);
+        BenchmarkFifo<std::deque<T>, T>("std::deque", count);
+        BenchmarkFifo<std::list<T>, T>("std::list", count);
+        BenchmarkFifo<DataStructures::PriorityQueue<T, KeyOrder<T>, CAPACITY>, T>("PriorityQueue", count);
+        BenchmarkFifo<std::priority_queue<T, std::vector<T>, ReverseKeyOrder<T>>, T>("std::priority_queue", count);
+
+        BenchmarkIterate<DataStructures::List<T>, T>("List", count);
+        BenchmarkIterate<DataStructures::PooledList<T, CAPACITY>, T>("PooledList", count);
+        BenchmarkIterate<std::deque<T>, T>("std::deque", count);
+        BenchmarkIterate<std::list<T>, T>("std::list", count);
+        BenchmarkIterate<std::vector<T>, T>("std::vector", count);
+
+        BenchmarkRandomAccess<DataStructures::List<T>, T>("List", count, true);
+        BenchmarkRandomAccess<DataStructures::PooledList<T, CAPACITY>, T>("PooledList", count, true);
+        BenchmarkRandomAccess<std::deque<T>, T>("std::deque", count, false);
+        BenchmarkRandomAccess<std::vector<T>, T>("std::vector", count, false);
+    }
+}
+
+} // end namespace
+
+int main() {
+    printf("container,element_bytes,count,operation,ops,ns_per_op\n");
+    RunElement<4>();
+    RunElement<32>();
+    RunElement<128>();
+
+    return (Sink == 0) ? 1 : 0;
+}
@@ -0,0 +1,207 @@
+/**
+ ********************************************************************************
+ * @file    StateManager_Benchmark.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Virtual-Time Dispatch Benchmark for the State Manager
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <Platform.hpp>
+#include <StateManager.hpp>
+
+using namespace StateManager;
+
+namespace {
+
+const int MAX_TASKS = 64;
+const SM_Time PERIODS_US[] = {
+    SM_US(500), SM_MS(1), SM_MS(2), SM_MS(5), SM_MS(10),
+    SM_MS(20), SM_MS(50), SM_MS(100), SM_MS(200), SM_MS(500), SM_MS(1000)
+};
+const double TARGET_UTILIZATION = 0.6;
+const uint64_t SIMULATED_US = 60ULL * 1000000ULL;
+const uint64_t LOOP_US = PLATFORM_HOST_LOOP_US;
+
+struct SyntheticTask {
+    SM_Time period_us;
+    uint64_t cost_us;
+    uint64_t last_start_us;
+    bool started;
+};
+
+SyntheticTask Tasks[MAX_TASKS];
+std::vector<uint64_t> Latencies;
+unsigned long long Dispatches = 0;
+
+// Each task records how late it started against its previous start plus one period
+template<int I>
+void SyntheticRun() {
+    SyntheticTask &task = Tasks[I];
+    uint64_t now = Platform::Clock::Now();
+    if (task.started) {
+        int64_t lateness = (int64_t)(now - task.last_start_us) - (int64_t)task.period_us;
+        Latencies.push_back((lateness < 0) ? -lateness : lateness);
+    }
+    task.started = true;
+    task.last_start_us = now;
+    Dispatches++;
+    Platform::Clock::Advance(task.cost_us);
+}
+
+template<int N>
+struct TaskTable {
+    static void Fill(SM_Function_t *table) {
+        TaskTable<N - 1>::Fill(table);
+        table[N - 1] = &SyntheticRun<N - 1>;
+    }
+};
+
+template<>
+struct TaskTable<0> {
+    static void Fill(SM_Function_t *) {}
+};
+
+const char *SchedulerName(SM_Scheduler scheduler) {
+    switch (scheduler) {
+        case SM_Scheduler::SCHEDULER_WEIGHTED_SCAN: return "weighted_scan";
+        case SM_Scheduler::SCHEDULER_DEADLINE_HEAP: return "deadline_heap";
+        case SM_Scheduler::SCHEDULER_EDF: return "edf";
+        case SM_Scheduler::SCHEDULER_RATE_MONOTONIC: return "rate_monotonic";
+    }
+    return "unknown";
+}
+
+uint64_t Percentile(std::vector<uint64_t> &samples, double percentile) {
+    if (samples.empty()) return 0;
+    size_t index = (size_t)(percentile * (samples.size() - 1));
+    return samples[index];
+}
+
+bool Admits(SM_Scheduler scheduler, int task_count, SM_Function_t *functions) {
+    ::StateManager::StateManager state_manager(scheduler);
+    for (int i = 0; i < task_count; i++) {
+        const SyntheticTask &task = Tasks[i];
+        if (state_manager.Register("synthetic", functions[i], task.period_us, SM_Priority::PRIORITY_MEDIUM, task.cost_us) == SM_INVALID_TASK) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Every scheduler must run the same task set for the rows to compare. Costs
+// take an equal share of the target utilization, capped so the longest job
+// fits the non-preemptive blocking budget of the shortest period, and shrink
+// further until the EDF and rate-monotonic admission tests both accept the set.
+double GenerateTasks(int task_count, SM_Function_t *functions) {
+    srand(task_count);
+    SM_Time min_period_us = (SM_Time)-1;
+    for (int i = 0; i < task_count; i++) {
+        Tasks[i].period_us = PERIODS_US[rand() % (sizeof(PERIODS_US) / sizeof(SM_Time))];
+        min_period_us = std::min(min_period_us, Tasks[i].period_us);
+    }
+    const uint64_t max_cost_us = (1 - TARGET_UTILIZATION) * min_period_us;
+    for (int i = 0; i < task_count; i++) {
+        SyntheticTask &task = Tasks[i];
+        task.cost_us = std::max<uint64_t>(1, std::min<uint64_t>(max_cost_us, TARGET_UTILIZATION * task.period_us / task_count));
+    }
+
+    while (!Admits(SM_Scheduler::SCHEDULER_EDF, task_count, functions) ||
+           !Admits(SM_Scheduler::SCHEDULER_RATE_MONOTONIC, task_count, functions)) {
+        bool scaled = false;
+        for (int i = 0; i < task_count; i++) {
+            SyntheticTask &task = Tasks[i];
+            uint64_t cost_us = std::max<uint64_t>(1, task.cost_us * 9 / 10);
+            if (cost_us != task.cost_us) scaled = true;
+            task.cost_us = cost_us;
+        }
+        if (!scaled) return -1;
+    }
+
+    double utilization = 0;
+    for (int i = 0; i < task_count; i++) {
+        utilization += (double)Tasks[i].cost_us / Tasks[i].period_us;
+    }
+    return utilization;
+}
+
+bool RunScenario(SM_Scheduler scheduler, int task_count, double utilization, SM_Function_t *functions) {
+    Platform::Clock::Set(0);
+    Latencies.clear();
+    Dispatches = 0;
+
+    ::StateManager::StateManager state_manager(scheduler);
+    int admitted = 0;
+    for (int i = 0; i < task_count; i++) {
+        SyntheticTask &task = Tasks[i];
+        task.started = false;
+        if (state_manager.Register("synthetic", functions[i], task.period_us, SM_Priority::PRIORITY_MEDIUM, task.cost_us) != SM_INVALID_TASK) {
+            admitted++;
+        }
+    }
+    if (admitted != task_count) {
+        fprintf(stderr, "%s admitted %d of %d tasks\n", SchedulerName(scheduler), admitted, task_count);
+        return false;
+    }
+
+    unsigned long long runs = 0;
+    auto wall_start = std::chrono::steady_clock::now();
+    while (Platform::Clock::Now() < SIMULATED_US) {
+        state_manager.Run();
+        Platform::Clock::Advance(LOOP_US);
+        runs++;
+    }
+    double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+
+    std::sort(Latencies.begin(), Latencies.end());
+    printf("%s,%d,%d,%.3f,%.1f,%.4f,%llu,%.0f,%.0f,%llu,%llu,%llu,%llu\n",
+           SchedulerName(scheduler), task_count, admitted, utilization,
+           SIMULATED_US / 1e6, wall_s, Dispatches,
+           Dispatches / wall_s, runs / wall_s,
+           (unsigned long long)Percentile(Latencies, 0.50),
+           (unsigned long long)Percentile(Latencies, 0.90),
+           (unsigned long long)Percentile(Latencies, 0.99),
+           (unsigned long long)(Latencies.empty() ? 0 : Latencies.back()));
+    return true;
+}
+
+} // end namespace
+
+int main() {
+    SM_Function_t functions[MAX_TASKS];
+    TaskTable<MAX_TASKS>::Fill(functions);
+
+    const SM_Scheduler schedulers[] = {
+        SM_Scheduler::SCHEDULER_WEIGHTED_SCAN,
+        SM_Scheduler::SCHEDULER_DEADLINE_HEAP,
+        SM_Scheduler::SCHEDULER_EDF,
+        SM_Scheduler::SCHEDULER_RATE_MONOTONIC
+    };
+    const int task_counts[] = {4, 16, 64};
+
+    printf("scheduler,tasks,admitted,utilization,simulated_s,wall_s,dispatches,dispatches_per_s,runs_per_s,"
+           "latency_p50_us,latency_p90_us,latency_p99_us,latency_max_us\n");
+    for (SM_Scheduler scheduler : schedulers) {
+        for (int task_count : task_counts) {
+            double utilization = GenerateTasks(task_count, functions);
+            if (utilization < 0) {
+                fprintf(stderr, "no admissible task set for %d tasks; build with SM_DISPATCH_OVERHEAD_US=0\n", task_count);
+                return 1;
+            }
+            if (!RunScenario(scheduler, task_count, utilization, functions)) return 1;
+        }
+    }
+
+    return 0;
+}
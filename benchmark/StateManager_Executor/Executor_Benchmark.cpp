@@ -0,0 +1,147 @@
+/**
+ ********************************************************************************
+ * @file    Executor_Benchmark.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Core-Count Scaling Benchmark for the Host Work-Stealing Executor
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <Platform.hpp>
+#include <StateManager.hpp>
+#include <StateManager_Executor.hpp>
+#include <StateManager_Process.hpp>
+
+using namespace StateManager;
+
+namespace {
+
+const int PLANTS = 32;
+const int PLANT_STEPS = 2000;
+const SM_Time PLANT_PERIOD_US = SM_MS(1);
+const double RUN_SECONDS = 2.0;
+
+// Damped oscillator integrated with RK4, standing in for a plant model
+struct Plant {
+    double position;
+    double velocity;
+};
+
+Plant Plants[PLANTS];
+std::atomic<unsigned long long> Steps(0);
+
+void Derivative(const Plant &state, double &dposition, double &dvelocity) {
+    dposition = state.velocity;
+    dvelocity = -4.0 * state.position - 0.1 * state.velocity;
+}
+
+template<int I>
+void PlantStep() {
+    Plant &plant = Plants[I];
+    const double dt = 1e-4;
+    for (int step = 0; step < PLANT_STEPS; step++) {
+        double k1p, k1v, k2p, k2v, k3p, k3v, k4p, k4v;
+        Derivative(plant, k1p, k1v);
+        Derivative({plant.position + 0.5 * dt * k1p, plant.velocity + 0.5 * dt * k1v}, k2p, k2v);
+        Derivative({plant.position + 0.5 * dt * k2p, plant.velocity + 0.5 * dt * k2v}, k3p, k3v);
+        Derivative({plant.position + dt * k3p, plant.velocity + dt * k3v}, k4p, k4v);
+        plant.position += dt / 6.0 * (k1p + 2.0 * k2p + 2.0 * k3p + k4p);
+        plant.velocity += dt / 6.0 * (k1v + 2.0 * k2v + 2.0 * k3v + k4v);
+    }
+    Steps++;
+}
+
+template<int N>
+struct PlantTable {
+    static void Fill(SM_Function_t *table) {
+        PlantTable<N - 1>::Fill(table);
+        table[N - 1] = &PlantStep<N - 1>;
+    }
+};
+
+template<>
+struct PlantTable<0> {
+    static void Fill(SM_Function_t *) {}
+};
+
+void Idle(SM_Time idle_us) {
+    Platform::Idle(idle_us);
+}
+
+// workers == 0 runs the plain single-threaded dispatcher
+double RunScenario(unsigned int workers, Process *processes, double baseline) {
+    for (int i = 0; i < PLANTS; i++) {
+        Plants[i].position = 1.0;
+        Plants[i].velocity = 0.0;
+    }
+    Steps = 0;
+
+    ::StateManager::StateManager state_manager;
+    for (int i = 0; i < PLANTS; i++) {
+        state_manager.Register("plant", &processes[i], PLANT_PERIOD_US, (SM_Priority)(1 + i % 5));
+    }
+    state_manager.SetIdleHook(Idle);
+
+    Executor *executor = NULL;
+    if (workers > 0) {
+        executor = new Executor(workers);
+        // A quarter of the plants keep strict affinity to exercise pinned queues
+        for (int i = 0; i < PLANTS; i += 4) state_manager.Pin(i, i % workers);
+        state_manager.SetExecutor(executor);
+    }
+
+    auto wall_start = std::chrono::steady_clock::now();
+    double wall_s = 0;
+    while (wall_s < RUN_SECONDS) {
+        state_manager.Run();
+        wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    }
+    unsigned long long steps = Steps;
+
+    unsigned long long steals = 0;
+    if (executor != NULL) {
+        steals = executor->Steals();
+        delete executor;
+    }
+
+    double steps_per_s = steps / wall_s;
+    printf("%s,%u,%d,%.3f,%llu,%.0f,%.2f,%llu\n",
+           (workers == 0) ? "serial" : "work_stealing", workers, PLANTS, wall_s,
+           steps, steps_per_s, (baseline > 0) ? steps_per_s / baseline : 1.0, steals);
+    return steps_per_s;
+}
+
+} // end namespace
+
+int main() {
+    Platform::Clock::SetMode(Platform::Clock::ClockMode::REALTIME);
+
+    SM_Function_t functions[PLANTS];
+    PlantTable<PLANTS>::Fill(functions);
+
+    static Process processes[PLANTS];
+    for (int i = 0; i < PLANTS; i++) processes[i].Register("plant_step", functions[i]);
+
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 1;
+
+    printf("executor,workers,tasks,wall_s,jobs,jobs_per_s,speedup,steals\n");
+    double baseline = RunScenario(0, processes, 0);
+    for (unsigned int workers = 1; workers <= cores; workers *= 2) {
+        RunScenario(workers, processes, baseline);
+    }
+    if ((cores & (cores - 1)) != 0) RunScenario(cores, processes, baseline);
+
+    return 0;
+}
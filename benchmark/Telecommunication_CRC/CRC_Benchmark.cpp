@@ -0,0 +1,131 @@
+/**
+ ********************************************************************************
+ * @file    CRC_Benchmark.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Host Correctness and Throughput Benchmark of the CRC32 Engine
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <vector>
+
+#include <Telecommunication_CRC.hpp>
+
+namespace {
+
+using namespace Telecommunication;
+
+const unsigned int SIZES[] = {16, 64, 256, 4096};
+const unsigned long long TARGET_BYTES = 64000000ULL;
+
+volatile Checksum Sink = 0;
+
+typedef Checksum (*UpdateFunction)(Checksum, const uint8_t*, StringSize);
+
+// The bitwise routine crc32() used before the engine existed
+Checksum Reference(Checksum crc, const uint8_t *data, StringSize length) {
+    for (StringSize i = 0; i < length; ++i) {
+        crc ^= data[i];
+        for (uint8_t j = 0; j < 8; j++) {
+            Checksum mask = -(crc & 1);
+            crc = (crc >> 1) ^ (0xEDB88320 & mask);
+        }
+    }
+    return crc;
+}
+
+// One byte at a time, the way the receiver feeds it
+Checksum Bytewise(Checksum crc, const uint8_t *data, StringSize length) {
+    for (StringSize i = 0; i < length; i++) crc = CRC::UpdateByte(crc, data[i]);
+    return crc;
+}
+
+struct Implementation {
+    const char *name;
+    UpdateFunction update;
+};
+
+const Implementation IMPLEMENTATIONS[] = {
+    {"reference", Reference},
+    {"bitwise", CRC::UpdateBitwise},
+    {"nibble", CRC::UpdateNibble},
+    {"slice_by_8", CRC::UpdateSliceBy8},
+    {"selected_bytewise", Bytewise},
+};
+
+std::vector<uint8_t> RandomBytes(size_t length) {
+    std::vector<uint8_t> bytes(length);
+    uint32_t state = 0x2545F491;
+    for (size_t i = 0; i < length; i++) {
+        state = state * 1664525u + 1013904223u;
+        bytes[i] = state >> 24;
+    }
+    return bytes;
+}
+
+// Every implementation against the reference over misaligned buffers of
+// every short length, both whole and split into streamed pieces
+bool Verify() {
+    bool ok = true;
+    const uint8_t CHECK_INPUT[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    std::vector<uint8_t> bytes = RandomBytes(1024);
+
+    for (const Implementation &implementation : IMPLEMENTATIONS) {
+        if (implementation.update(CRC::INITIAL, CHECK_INPUT, sizeof(CHECK_INPUT)) != 0x340BC6D9) {
+            printf("# %s: wrong check value\n", implementation.name);
+            ok = false;
+        }
+        for (unsigned int offset = 0; offset < 8; offset++) {
+            for (unsigned int length = 0; length <= 512; length++) {
+                const uint8_t *data = &bytes[offset];
+                Checksum expected = Reference(CRC::INITIAL, data, length);
+                Checksum whole = implementation.update(CRC::INITIAL, data, length);
+                Checksum split = implementation.update(implementation.update(CRC::INITIAL, data, length / 3), data + length / 3, length - length / 3);
+                if (whole != expected || split != expected) {
+                    printf("# %s: mismatch at offset %u length %u\n", implementation.name, offset, length);
+                    ok = false;
+                    break;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+void Benchmark(const Implementation &implementation, unsigned int size) {
+    std::vector<uint8_t> bytes = RandomBytes(size);
+    unsigned long long rounds = TARGET_BYTES / size;
+    if (implementation.update == Reference || implementation.update == CRC::UpdateBitwise) rounds /= 8;
+    if (rounds == 0) rounds = 1;
+    Checksum crc = CRC::INITIAL;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long round = 0; round < rounds; round++) {
+        crc = implementation.update(crc, bytes.data(), size);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    unsigned long long total = rounds * size;
+    printf("%s,%u,%llu,%.3f,%.1f\n", implementation.name, size, total, ns / total, total / ns * 1000.0);
+    Sink ^= crc;
+}
+
+} // end namespace
+
+int main() {
+    if (!Verify()) return 1;
+
+    printf("implementation,bytes,total_bytes,ns_per_byte,mb_per_s\n");
+    for (const Implementation &implementation : IMPLEMENTATIONS) {
+        for (unsigned int size : SIZES) Benchmark(implementation, size);
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+/**
+ ********************************************************************************
+ * @file    Lookup_Benchmark.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Host Benchmark of Command and Keyword Decoding
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <Telecommunication_Literals.hpp>
+#include <Telecommunication_Types.hpp>
+#include <Telecommunication_Utilities.hpp>
+
+namespace {
+
+using namespace Telecommunication;
+
+const unsigned long long TARGET_TOKENS = 4000000ULL;
+
+volatile long Sink = 0;
+
+// The first-prefix-match scans GetCommand and GetKeyword used to run
+int ScanCommand(char* &ptr) {
+    for (int i = 0; i < (int)Command::COMMAND_COUNT; i++) {
+        StringSize length = strlen(CommandLiterals[i]);
+        if (strncmp(ptr, CommandLiterals[i], length) == 0) {
+            ptr += length;
+            return i;
+        }
+    }
+    return (int)Command::NO_COMMAND;
+}
+
+int ScanKeyword(char* &ptr) {
+    for (int i = 0; i < (int)Keyword::KEYWORD_COUNT; i++) {
+        StringSize length = strlen(KeywordLiterals[i]);
+        if (strncmp(ptr, KeywordLiterals[i], length) == 0) {
+            ptr += length;
+            return i;
+        }
+    }
+    return (int)Keyword::NO_KEYWORD;
+}
+
+int HashCommand(char* &ptr) { return (int)Decoding::GetCommand(ptr); }
+int HashKeyword(char* &ptr) { return (int)Decoding::GetKeyword(ptr); }
+
+typedef int (*Decoder)(char* &ptr);
+
+// Tokens as they appear in a frame, followed by the delimiter that ends them
+std::vector<std::string> Tokens(CString *literals, int count, const char *delimiter) {
+    std::vector<std::string> tokens;
+    for (int i = 0; i < count; i++) tokens.push_back(std::string(literals[i]) + delimiter);
+    return tokens;
+}
+
+bool Expect(Decoder decoder, const char *token, int expected, StringSize consumed) {
+    std::string copy(token);
+    char *ptr = &copy[0];
+    int result = decoder(ptr);
+    if (result != expected || (StringSize)(ptr - &copy[0]) != consumed) {
+        printf("# \"%s\" decoded to %d after %d bytes, expected %d after %u\n", token, result, (int)(ptr - &copy[0]), expected, consumed);
+        return false;
+    }
+    return true;
+}
+
+bool Verify() {
+    bool ok = true;
+    for (int i = 0; i < (int)Command::COMMAND_COUNT; i++) {
+        ok &= Expect(HashCommand, (std::string(CommandLiterals[i]) + ", ").c_str(), i, strlen(CommandLiterals[i]));
+    }
+    for (int i = 0; i < (int)Keyword::KEYWORD_COUNT; i++) {
+        ok &= Expect(HashKeyword, (std::string(KeywordLiterals[i]) + " 1").c_str(), i, strlen(KeywordLiterals[i]));
+    }
+
+    // Prefixes of longer literals must not shadow them, and near misses must fail
+    ok &= Expect(HashCommand, "SET_POWER, ", (int)Command::TC_SET_POWER, 9);
+    ok &= Expect(HashCommand, "GET_STATE, ", (int)Command::TR_GET_STATE, 9);
+    ok &= Expect(HashCommand, "GET_ERRORS, ", (int)Command::TR_GET_ERRORS, 10);
+    ok &= Expect(HashCommand, "SE, ", (int)Command::NO_COMMAND, 0);
+    ok &= Expect(HashCommand, "SET_POWERS, ", (int)Command::NO_COMMAND, 0);
+    ok &= Expect(HashCommand, "set, ", (int)Command::NO_COMMAND, 0);
+    ok &= Expect(HashCommand, "", (int)Command::NO_COMMAND, 0);
+    ok &= Expect(HashKeyword, "TASK_EXEC_AVG 1", (int)Keyword::KW_TASK_EXEC_AVG, 13);
+    ok &= Expect(HashKeyword, "GAIN1 1", (int)Keyword::NO_KEYWORD, 0);
+    ok &= Expect(HashKeyword, "Q5 1", (int)Keyword::NO_KEYWORD, 0);
+    return ok;
+}
+
+void Benchmark(const char *table, const char *method, Decoder decoder, std::vector<std::string> tokens) {
+    std::vector<char*> starts;
+    for (std::string &token : tokens) starts.push_back(&token[0]);
+    unsigned long long rounds = TARGET_TOKENS / tokens.size();
+    long sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long round = 0; round < rounds; round++) {
+        for (char *token : starts) {
+            char *ptr = token;
+            sum += decoder(ptr) + (ptr - token);
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    unsigned long long total = rounds * tokens.size();
+    printf("%s,%s,%llu,%.2f\n", table, method, total, ns / total);
+    Sink += sum;
+}
+
+} // end namespace
+
+int main() {
+    if (!Verify()) return 1;
+
+    std::vector<std::string> commands = Tokens(CommandLiterals, (int)Command::COMMAND_COUNT, ", ");
+    std::vector<std::string> keywords = Tokens(KeywordLiterals, (int)Keyword::KEYWORD_COUNT, " ");
+
+    printf("table,method,tokens,ns_per_token\n");
+    Benchmark("command", "scan", ScanCommand, commands);
+    Benchmark("command", "perfect_hash", HashCommand, commands);
+    Benchmark("keyword", "scan", ScanKeyword, keywords);
+    Benchmark("keyword", "perfect_hash", HashKeyword, keywords);
+
+    return 0;
+}
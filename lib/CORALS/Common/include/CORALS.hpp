@@ -19,6 +19,7 @@ namespace CORALS {
 
 void initialize();
 void run();
+void signal(::StateManager::SM_Event event);
 
 } // end namespace CORALS
 
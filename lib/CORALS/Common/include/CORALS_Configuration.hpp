@@ -13,9 +13,20 @@
 #ifndef __CORALS_CONFIGURATION_HPP__
 #define __CORALS_CONFIGURATION_HPP__
 
-#include <Arduino.h>
+#include <Platform.hpp>
 
 // Serial USART Allocation
-#define DEBUG Serial
+#define DEBUG PLATFORM_DEBUG_CONSOLE
+
+// Task Scheduling
+#define CORALS_TELECOM_PERIOD_MS 10
+#define CORALS_TELECOM_BUDGET_US 2000
+#define CORALS_LOGGING_PERIOD_MS 50
+
+// Event IDs
+#define CORALS_EVENT_TELECOM_RX 0
+
+// Sleep between Tasks instead of Spinning
+#define CORALS_IDLE_SLEEP true
 
 #endif // __CORALS_CONFIGURATION_HPP__
\ No newline at end of file
@@ -12,24 +12,61 @@
 
 #include "CORALS.hpp"
 
+#include <Logging.hpp>
+#include <Platform.hpp>
+#include <Platform_Memory.hpp>
 #include <StateManager.hpp>
 
 #include "CORALS_Configuration.hpp"
+#include "CORALS_Telecommunication.hpp"
 
 namespace CORALS {
 
 namespace {
 
-::StateManager::StateManager CORALS_OS;
+// Receive, delegate and transmit share one slot, bounded by the budget
+::StateManager::Process TELECOM_PROCESS(CORALS_TELECOM_BUDGET_US);
+
+void flush_log() {
+    Logging::Flush();
+}
+
+void idle(::StateManager::SM_Time idle_us) {
+    Platform::Idle(idle_us);
+}
+
+// Positions in CORALS_TASKS
+const ::StateManager::SM_TaskIndex TELECOM_TASK = 0;
+
+constexpr ::StateManager::SM_TaskDescriptor CORALS_TASKS[] = {
+    {"Telecommunication", &TELECOM_PROCESS, SM_MS(CORALS_TELECOM_PERIOD_MS), ::StateManager::SM_Priority::PRIORITY_HIGH, CORALS_TELECOM_BUDGET_US},
+    {"Logging", flush_log, SM_MS(CORALS_LOGGING_PERIOD_MS), ::StateManager::SM_Priority::PRIORITY_LOWEST}
+};
+
+::StateManager::StateManager CORALS_OS(CORALS_TASKS);
 
 } // end namespace
 
 void initialize() {
+    Platform::Memory::PaintStack();
     DEBUG.begin(115200);
+
+    Telcommunication::initialize(&CORALS_OS);
+    TELECOM_PROCESS.Register("Telecom_Receive", Telcommunication::receive);
+    TELECOM_PROCESS.Register("Telecom_Delegate", Telcommunication::delegate);
+    TELECOM_PROCESS.Register("Telecom_Transmit", Telcommunication::transmit);
+
+    CORALS_OS.Bind(CORALS_EVENT_TELECOM_RX, TELECOM_TASK);
+
+    if (CORALS_IDLE_SLEEP) CORALS_OS.SetIdleHook(idle);
 }
 
 void run() {
     CORALS_OS.Run();
 }
 
+void signal(::StateManager::SM_Event event) {
+    CORALS_OS.Signal(event);
+}
+
 } // end namespace CORALS
\ No newline at end of file
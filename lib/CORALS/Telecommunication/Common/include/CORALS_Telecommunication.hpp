@@ -13,6 +13,7 @@
 #ifndef __CORALS_TELECOMMUNICATION_HPP__
 #define __CORALS_TELECOMMUNICATION_HPP__
 
+#include <StateManager.hpp>
 #include <Telecommunication.hpp>
 #include <Telecommunication_Delegator.hpp>
 #include <Telecommunication_Interpreter.hpp>
@@ -28,11 +29,11 @@ using ::Telecommunication::TelecommunicationInterpreter;
 using ::Telecommunication::Command;
 using ::Telecommunication::Keyword;
 
-void initialize();
+void initialize(::StateManager::StateManager *state_manager);
 
 void receive();
 void transmit();
-void delegate();
+::StateManager::SM_CoroutineStatus delegate(::StateManager::SM_CoroutineState &state);
 
 void Register_RxInterpreter(Command command, TelecommunicationInterpreter *interpreter);
 
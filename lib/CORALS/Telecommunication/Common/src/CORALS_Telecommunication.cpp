@@ -12,22 +12,43 @@
 
 #include "CORALS_Telecommunication.hpp"
 
+#include <Platform_Memory.hpp>
+#include <StateManager.hpp>
 #include <Telecommunication.hpp>
 #include <Telecommunication_Delegator.hpp>
 
+#include "Get_Interpreter.hpp"
+#include "Link_Interpreter.hpp"
+
 namespace CORALS {
 namespace Telcommunication {
 
 namespace {
 
+// Allocated once at start-up and never freed
+Platform::Memory::Counter SETUP_MEMORY("Telecom_Setup");
+
 Telecommunication *TELECOM;
 TelecommunicationDelegator *DELEGATOR;
 
+GetStateInterpreter *GET_STATE_INTERPRETER;
+SetLinkInterpreter *SET_LINK_INTERPRETER;
+
 } // end namespace
 
-void initialize() {
+void initialize(::StateManager::StateManager *state_manager) {
     TELECOM = new Telecommunication();
+    SETUP_MEMORY.Allocated();
     DELEGATOR = new TelecommunicationDelegator(TELECOM);
+    SETUP_MEMORY.Allocated();
+
+    GET_STATE_INTERPRETER = new GetStateInterpreter(TELECOM, state_manager);
+    SETUP_MEMORY.Allocated();
+    Register_RxInterpreter(Command::TR_GET_STATE, GET_STATE_INTERPRETER);
+
+    SET_LINK_INTERPRETER = new SetLinkInterpreter(TELECOM);
+    SETUP_MEMORY.Allocated();
+    Register_RxInterpreter(Command::TC_SET_LINK, SET_LINK_INTERPRETER);
 }
 
 void receive() {
@@ -38,8 +59,17 @@ void transmit() {
     TELECOM->Transmit();
 }
 
-void delegate() {
-    DELEGATOR->run();
+// Interprets one message per slot so a burst of commands cannot stall the loop
+::StateManager::SM_CoroutineStatus delegate(::StateManager::SM_CoroutineState &state) {
+    SM_CO_BEGIN(state);
+    while (DELEGATOR->step()) {
+        SM_CO_YIELD(state);
+    }
+    SM_CO_END(state);
+}
+
+void Register_RxInterpreter(Command command, TelecommunicationInterpreter *interpreter) {
+    DELEGATOR->AddInterpreter(command, interpreter);
 }
 
 } // end namespace Telcommunication
@@ -0,0 +1,42 @@
+/**
+ ********************************************************************************
+ * @file    Link_Interpreter.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Link Mode Interpreter
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __LINK_INTERPRETER_HPP__
+#define __LINK_INTERPRETER_HPP__
+
+#include <Telecommunication.hpp>
+#include <Telecommunication_Interpreter.hpp>
+#include <Telecommunication_Types.hpp>
+
+namespace CORALS {
+namespace Telcommunication {
+
+using ::Telecommunication::Telecommunication;
+using ::Telecommunication::TelecommunicationInterpreter;
+using ::Telecommunication::TeleMessage;
+
+// SET_LINK, LINK_MODE BINARY switches both directions of the link. The
+// LINK_STATE reply still goes out in the old mode, so the ground station
+// switches once it sees it. Without LINK_MODE the current mode is reported.
+class SetLinkInterpreter : public TelecommunicationInterpreter {
+    public:
+        SetLinkInterpreter(Telecommunication *telecommunicator);
+        ~SetLinkInterpreter();
+
+        void Interpret(TeleMessage message) override;
+
+};
+
+} // end namespace Telcommunication
+} // end namespace CORALS
+
+#endif // __LINK_INTERPRETER_HPP__
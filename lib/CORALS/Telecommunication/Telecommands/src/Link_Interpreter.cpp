@@ -0,0 +1,65 @@
+/**
+ ********************************************************************************
+ * @file    Link_Interpreter.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Link Mode Interpreter
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Link_Interpreter.hpp"
+
+#include <Telecommunication_Literals.hpp>
+#include <Telecommunication_Types.hpp>
+
+namespace CORALS {
+namespace Telcommunication {
+
+using ::Telecommunication::Command;
+using ::Telecommunication::Keyword;
+using ::Telecommunication::KeyValue;
+using ::Telecommunication::LinkMode;
+using ::Telecommunication::ParameterType;
+using ::Telecommunication::String;
+
+namespace {
+
+const Keyword SET_LINK_KEYWORDS[] = {
+    Keyword::KW_LINK_MODE
+};
+
+} // end namespace
+
+SetLinkInterpreter::SetLinkInterpreter(Telecommunication *telecommunicator)
+    : TelecommunicationInterpreter(telecommunicator, Command::TC_SET_LINK, SET_LINK_KEYWORDS, sizeof(SET_LINK_KEYWORDS) / sizeof(Keyword)) {}
+
+SetLinkInterpreter::~SetLinkInterpreter() {}
+
+void SetLinkInterpreter::Interpret(TeleMessage message) {
+    LinkMode mode = telecommunicator->GetLinkMode();
+    for (unsigned int i = 0; i < message.pair_count; i++) {
+        if (message.key_value_pairs[i].keyword == Keyword::KW_LINK_MODE) {
+            mode = (message.key_value_pairs[i].value.string == ::Telecommunication::BINARY_LITERAL) ? LinkMode::BINARY : LinkMode::ASCII;
+        }
+    }
+
+    KeyValue key_value_pairs[1];
+    key_value_pairs[0].keyword = Keyword::KW_LINK_MODE;
+    key_value_pairs[0].type = ParameterType::STRING;
+    key_value_pairs[0].value.string = (String)((mode == LinkMode::BINARY) ? ::Telecommunication::BINARY_LITERAL : ::Telecommunication::ASCII_LITERAL);
+
+    TeleMessage reply;
+    reply.command = Command::TR_LINK_STATE;
+    reply.key_value_pairs = key_value_pairs;
+    reply.pair_count = sizeof(key_value_pairs) / sizeof(KeyValue);
+    reply.valid = true;
+
+    Reply(reply);
+    telecommunicator->SetLinkMode(mode);
+}
+
+} // end namespace Telcommunication
+} // end namespace CORALS
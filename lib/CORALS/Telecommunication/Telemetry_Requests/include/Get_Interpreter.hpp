@@ -2,10 +2,46 @@
  ********************************************************************************
  * @file    Get_Interpreter.hpp
  * @author  Logan Ruddick (Logan@Ruddicks.net)
- * @brief   Set Interpreter
+ * @brief   Get Interpreter
  * @version 1.0
  * @date    2024-03-22
  ********************************************************************************
  * @copyright Copyright (c) 2024
  ********************************************************************************
-**/
\ No newline at end of file
+**/
+
+#ifndef __GET_INTERPRETER_HPP__
+#define __GET_INTERPRETER_HPP__
+
+#include <StateManager.hpp>
+#include <Telecommunication.hpp>
+#include <Telecommunication_Interpreter.hpp>
+#include <Telecommunication_Types.hpp>
+
+namespace CORALS {
+namespace Telcommunication {
+
+using ::Telecommunication::Telecommunication;
+using ::Telecommunication::TelecommunicationInterpreter;
+using ::Telecommunication::TeleMessage;
+
+class GetStateInterpreter : public TelecommunicationInterpreter {
+    public:
+        GetStateInterpreter(Telecommunication *telecommunicator, ::StateManager::StateManager *state_manager);
+        ~GetStateInterpreter();
+
+        void Interpret(TeleMessage message) override;
+
+    private:
+        void ReplyTaskState(::StateManager::SM_TaskIndex index);
+        void ReplyMemoryState();
+        void ReplySystemState();
+
+        ::StateManager::StateManager *state_manager;
+
+};
+
+} // end namespace Telcommunication
+} // end namespace CORALS
+
+#endif // __GET_INTERPRETER_HPP__
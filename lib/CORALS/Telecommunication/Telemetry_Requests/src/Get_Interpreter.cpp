@@ -2,10 +2,138 @@
  ********************************************************************************
  * @file    Get_Interpreter.cpp
  * @author  Logan Ruddick (Logan@Ruddicks.net)
- * @brief   Set Interpreter
+ * @brief   Get Interpreter
  * @version 1.0
  * @date    2024-03-22
  ********************************************************************************
  * @copyright Copyright (c) 2024
  ********************************************************************************
-**/
\ No newline at end of file
+**/
+
+#include "Get_Interpreter.hpp"
+
+#include <Platform_Memory.hpp>
+#include <StateManager.hpp>
+#include <Telecommunication_Types.hpp>
+
+namespace CORALS {
+namespace Telcommunication {
+
+using ::Telecommunication::Command;
+using ::Telecommunication::Keyword;
+using ::Telecommunication::KeyValue;
+using ::Telecommunication::ParameterType;
+using ::Telecommunication::String;
+
+namespace {
+
+const Keyword GET_STATE_KEYWORDS[] = {
+    Keyword::KW_TASK_ID
+};
+
+void SetInteger(KeyValue &key_value, Keyword keyword, long int value) {
+    key_value.keyword = keyword;
+    key_value.type = ParameterType::INTEGER;
+    key_value.value.integer = value;
+}
+
+} // end namespace
+
+GetStateInterpreter::GetStateInterpreter(Telecommunication *telecommunicator, ::StateManager::StateManager *state_manager)
+    : TelecommunicationInterpreter(telecommunicator, Command::TR_GET_STATE, GET_STATE_KEYWORDS, sizeof(GET_STATE_KEYWORDS) / sizeof(Keyword)),
+      state_manager(state_manager) {}
+
+GetStateInterpreter::~GetStateInterpreter() {}
+
+void GetStateInterpreter::Interpret(TeleMessage message) {
+    bool task_selected = false;
+    for (unsigned int i = 0; i < message.pair_count; i++) {
+        if (message.key_value_pairs[i].keyword == Keyword::KW_TASK_ID) {
+            ReplyTaskState(message.key_value_pairs[i].value.integer);
+            task_selected = true;
+        }
+    }
+
+    if (!task_selected) {
+        for (::StateManager::SM_TaskIndex i = 0; i < state_manager->TaskCount(); i++) {
+            ReplyTaskState(i);
+        }
+    }
+
+    ReplyMemoryState();
+    ReplySystemState();
+}
+
+void GetStateInterpreter::ReplySystemState() {
+    // Idle Fraction in Parts per Million, Memory in Bytes
+    KeyValue key_value_pairs[5];
+    SetInteger(key_value_pairs[0], Keyword::KW_IDLE_FRACTION, state_manager->IdleFraction());
+    SetInteger(key_value_pairs[1], Keyword::KW_HEAP_FREE, Platform::Memory::FreeHeap());
+    SetInteger(key_value_pairs[2], Keyword::KW_HEAP_LARGEST, Platform::Memory::LargestFreeBlock());
+    SetInteger(key_value_pairs[3], Keyword::KW_STACK_HIGH_WATER, Platform::Memory::StackHighWater());
+    SetInteger(key_value_pairs[4], Keyword::KW_TX_OVERFLOWS, telecommunicator->TransmitOverflows());
+
+    TeleMessage reply;
+    reply.command = Command::TR_CORALS_STATE;
+    reply.key_value_pairs = key_value_pairs;
+    reply.pair_count = sizeof(key_value_pairs) / sizeof(KeyValue);
+    reply.valid = true;
+
+    Reply(reply);
+}
+
+void GetStateInterpreter::ReplyMemoryState() {
+    // One reply per instrumented subsystem
+    for (Platform::Memory::Counter *counter = Platform::Memory::Counter::First(); counter != NULL; counter = counter->Next()) {
+        KeyValue key_value_pairs[4];
+        key_value_pairs[0].keyword = Keyword::KW_MEMORY_NAME;
+        key_value_pairs[0].type = ParameterType::STRING;
+        key_value_pairs[0].value.string = (String)counter->Name();
+        SetInteger(key_value_pairs[1], Keyword::KW_MEMORY_ALLOCS, counter->Allocations());
+        SetInteger(key_value_pairs[2], Keyword::KW_MEMORY_LIVE, counter->Live());
+        SetInteger(key_value_pairs[3], Keyword::KW_MEMORY_PEAK, counter->Peak());
+
+        TeleMessage reply;
+        reply.command = Command::TR_CORALS_STATE;
+        reply.key_value_pairs = key_value_pairs;
+        reply.pair_count = sizeof(key_value_pairs) / sizeof(KeyValue);
+        reply.valid = true;
+
+        Reply(reply);
+    }
+}
+
+void GetStateInterpreter::ReplyTaskState(::StateManager::SM_TaskIndex index) {
+    ::StateManager::SM_TaskReport report;
+    if (!state_manager->GetTaskReport(index, report)) return;
+
+    const ::StateManager::SM_TaskStats &stats = report.stats;
+    unsigned long exec_avg_us = (stats.calls > 0) ? stats.exec_total_us / stats.calls : 0;
+    unsigned long periodic_calls = stats.calls - stats.events;
+    unsigned long jitter_avg_us = (periodic_calls > 1) ? stats.jitter_total_us / (periodic_calls - 1) : 0;
+
+    KeyValue key_value_pairs[10];
+    SetInteger(key_value_pairs[0], Keyword::KW_TASK_ID, index);
+    key_value_pairs[1].keyword = Keyword::KW_TASK_NAME;
+    key_value_pairs[1].type = ParameterType::STRING;
+    key_value_pairs[1].value.string = (String)report.name;
+    SetInteger(key_value_pairs[2], Keyword::KW_TASK_CALLS, stats.calls);
+    SetInteger(key_value_pairs[3], Keyword::KW_TASK_EXEC_MIN, (stats.calls > 0) ? stats.exec_min_us : 0);
+    SetInteger(key_value_pairs[4], Keyword::KW_TASK_EXEC_AVG, exec_avg_us);
+    SetInteger(key_value_pairs[5], Keyword::KW_TASK_EXEC_MAX, stats.exec_max_us);
+    SetInteger(key_value_pairs[6], Keyword::KW_TASK_JITTER_AVG, jitter_avg_us);
+    SetInteger(key_value_pairs[7], Keyword::KW_TASK_JITTER_MAX, stats.jitter_max_us);
+    SetInteger(key_value_pairs[8], Keyword::KW_TASK_OVERRUNS, stats.overruns);
+    SetInteger(key_value_pairs[9], Keyword::KW_TASK_EVENTS, stats.events);
+
+    TeleMessage reply;
+    reply.command = Command::TR_CORALS_STATE;
+    reply.key_value_pairs = key_value_pairs;
+    reply.pair_count = sizeof(key_value_pairs) / sizeof(KeyValue);
+    reply.valid = true;
+
+    Reply(reply);
+}
+
+} // end namespace Telcommunication
+} // end namespace CORALS
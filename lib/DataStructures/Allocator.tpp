@@ -0,0 +1,105 @@
+/**
+ ********************************************************************************
+ * @file    Allocator.tpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Node Allocator Policies for the Linked Data Structures
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __ALLOCATOR_TPP__
+#define __ALLOCATOR_TPP__
+
+#include <stdlib.h>
+
+namespace DataStructures {
+
+using PoolSize_t = unsigned int;
+
+// Allocators hand out raw storage for one Node; the container constructs
+// and destroys the Node in place. The default gives each node its own heap block.
+template<typename Node>
+class HeapAllocator {
+
+    public:
+
+        inline void* allocate() { return ::operator new(sizeof(Node)); }
+        inline void deallocate(void *node) { ::operator delete(node); }
+
+};
+
+// Fixed-block pool carved from a contiguous array. Blocks never seen before
+// are handed out in order and released blocks are recycled through a free
+// list threaded through their storage, so both paths are O(1).
+template<typename Node, PoolSize_t N>
+class StaticPool {
+
+    static_assert(N > 0, "StaticPool must hold at least one block");
+
+    union Block {
+        Block *next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    public:
+
+        StaticPool() : free_list(NULL), unused(0), in_use(0), peak(0), failure_count(0) {}
+        ~StaticPool() {}
+
+        // Blocks and the free list point into this pool's own storage
+        StaticPool(const StaticPool &) = delete;
+        StaticPool &operator=(const StaticPool &) = delete;
+
+        void* allocate() {
+            Block *block;
+            if (free_list != NULL) {
+                block = free_list;
+                free_list = block->next;
+            }
+            else if (unused < N) {
+                block = &blocks[unused++];
+            }
+            else {
+                failure_count++;
+                return NULL;
+            }
+
+            in_use++;
+            if (in_use > peak) peak = in_use;
+            return block->storage;
+        }
+        void deallocate(void *node) {
+            if (node == NULL) return;
+
+            Block *block = static_cast<Block*>(node);
+            block->next = free_list;
+            free_list = block;
+            in_use--;
+        }
+
+        inline PoolSize_t capacity() { return N; }
+        inline PoolSize_t used() { return in_use; }
+        inline PoolSize_t available() { return N - in_use; }
+        inline PoolSize_t high_water() { return peak; }
+
+        // Allocations refused because every block was in use
+        inline unsigned long failures() { return failure_count; }
+
+    private:
+
+        Block blocks[N];
+        Block *free_list;
+        PoolSize_t unused;
+
+        PoolSize_t in_use;
+        PoolSize_t peak;
+        unsigned long failure_count;
+
+};
+
+} // end namespace DataStructures
+
+#endif // __ALLOCATOR_TPP__
@@ -15,12 +15,18 @@
 
 #include <stdlib.h>
 
+#include "Allocator.tpp"
+#include "Utility.tpp"
+
 namespace DataStructures {
 
 namespace __List {
 
 template<typename _T>
 struct ListNode {
+    template<typename... _Args>
+    ListNode(_Args&&... args) : prev(NULL), next(NULL), data(Forward<_Args>(args)...) {}
+
     ListNode<_T> *prev;
     ListNode<_T> *next;
     _T data;
@@ -30,95 +36,139 @@ struct ListNode {
 
 using ListSize_t = unsigned int;
 
-template<typename T>
+template<typename T, typename Allocator = HeapAllocator<__List::ListNode<T>>>
 class List {
 
     using ListNode = __List::ListNode<T>;
 
+    // Bidirectional cursor; end() holds no node, and decrementing it yields back
+    template<typename Value>
+    class Iterator {
+
+        friend class List;
+        template<typename> friend class Iterator;
+
+        public:
+
+            Iterator() : node(NULL), list(NULL) {}
+
+            // iterator -> const_iterator only; the pointer initialisation rejects the reverse
+            template<typename Other>
+            Iterator(const Iterator<Other> &other) : node(other.node), list(other.list) {
+                Value *constness = (Other*)NULL;
+                (void)constness;
+            }
+
+            inline Value& operator*() const { return node->data; }
+            inline Value* operator->() const { return &node->data; }
+
+            inline Iterator& operator++() {
+                node = node->next;
+                return *this;
+            }
+            inline Iterator operator++(int) {
+                Iterator previous = *this;
+                node = node->next;
+                return previous;
+            }
+            inline Iterator& operator--() {
+                node = (node == NULL) ? list->back : node->prev;
+                return *this;
+            }
+            inline Iterator operator--(int) {
+                Iterator previous = *this;
+                --(*this);
+                return previous;
+            }
+
+            inline bool operator==(const Iterator &other) const { return node == other.node; }
+            inline bool operator!=(const Iterator &other) const { return node != other.node; }
+
+        private:
+
+            Iterator(ListNode *node, const List *list) : node(node), list(list) {}
+
+            ListNode *node;
+            const List *list;
+
+    };
+
     public:
 
+        using iterator = Iterator<T>;
+        using const_iterator = Iterator<const T>;
+
         List() {
             front = NULL;
             back = NULL;
             list_size = 0;
         }
         ~List() {
-            T temp;
-            while (list_size > 0) pop_front(temp);
+            clear();
         }
 
-        void push_front(T data) {
-            if (list_size == 0) {
-                front = back = new ListNode;
-                front->data = data;
-                front->prev = NULL;
-                front->next = NULL;
-            }
-            else {
-                front->prev = new ListNode;
-                front = front->prev;
-                front->data = data;
-                front->prev = NULL;
-            }
+        inline bool push_front(const T &data) { return emplace_front(data); }
+        inline bool push_front(T &&data) { return emplace_front(Move(data)); }
+        inline bool push_back(const T &data) { return emplace_back(data); }
+        inline bool push_back(T &&data) { return emplace_back(Move(data)); }
+
+        // Construct the element directly in its node
+        template<typename... Args>
+        bool emplace_front(Args&&... args) {
+            ListNode *node = Create(Forward<Args>(args)...);
+            if (node == NULL) return false;
+            node->next = front;
+            if (list_size == 0) back = node;
+            else front->prev = node;
+            front = node;
             list_size++;
+            return true;
         }
-        void push_back(T data) {
-            if (list_size == 0) {
-                front = back = new ListNode;
-                back->data = data;
-                back->prev = NULL;
-                back->next = NULL;
-            }
-            else {
-                back->next = new ListNode;
-                back = back->next;
-                back->data = data;
-                back->next = NULL;
-            }
+        template<typename... Args>
+        bool emplace_back(Args&&... args) {
+            ListNode *node = Create(Forward<Args>(args)...);
+            if (node == NULL) return false;
+            node->prev = back;
+            if (list_size == 0) front = node;
+            else back->next = node;
+            back = node;
             list_size++;
+            return true;
         }
 
         void pop_front(T& data) {
             if (list_size == 0) return;
-            data = front->data;
-            list_size--;
-            if (list_size == 0) {
-                delete front;
-                front = NULL;
-                back = NULL;
-            }
-            else {
-                front = front->next;
-                delete front->prev;
-                front->prev = NULL;
-            }
+            data = Move(front->data);
+            erase(begin());
         }
         void pop_back(T& data) {
             if (list_size == 0) return;
-            data = back->data;
-            list_size--;
-            if (list_size == 0) {
-                delete back;
-                front = NULL;
-                back = NULL;
-            }
-            else {
-                back = back->prev;
-                delete back->next;
-                back->next = NULL;
-            }
+            data = Move(back->data);
+            erase(iterator(back, this));
         }
         T pop_front() {
-            T data;
-            pop_front(data);
+            if (list_size == 0) return T();
+            T data(Move(front->data));
+            erase(begin());
             return data;
         }
         T pop_back() {
-            T data;
-            pop_back(data);
+            if (list_size == 0) return T();
+            T data(Move(back->data));
+            erase(iterator(back, this));
             return data;
         }
 
+        void clear() {
+            while (front != NULL) {
+                ListNode *next = front->next;
+                Destroy(front);
+                front = next;
+            }
+            back = NULL;
+            list_size = 0;
+        }
+
         inline T& peek_front() {
             return front->data;
         }
@@ -149,8 +199,45 @@ class List {
             return current->data;
         }
 
+        inline iterator begin() { return iterator(front, this); }
+        inline iterator end() { return iterator(NULL, this); }
+        inline const_iterator begin() const { return const_iterator(front, this); }
+        inline const_iterator end() const { return const_iterator(NULL, this); }
+
+        // Unlinks the element at position and returns the one after it, so a
+        // loop can keep going with `it = list.erase(it)`
+        iterator erase(iterator position) {
+            ListNode *node = position.node;
+            if (node == NULL) return end();
+            ListNode *next = node->next;
+
+            if (node->prev == NULL) front = next;
+            else node->prev->next = next;
+            if (next == NULL) back = node->prev;
+            else next->prev = node->prev;
+
+            Destroy(node);
+            list_size--;
+            return iterator(next, this);
+        }
+
+        inline Allocator& get_allocator() { return allocator; }
+
     private:
 
+        template<typename... Args>
+        ListNode* Create(Args&&... args) {
+            void *memory = allocator.allocate();
+            if (memory == NULL) return NULL;
+            return new (memory) ListNode(Forward<Args>(args)...);
+        }
+        void Destroy(ListNode *node) {
+            node->~ListNode();
+            allocator.deallocate(node);
+        }
+
+        Allocator allocator;
+
         ListNode *front;
         ListNode *back;
 
@@ -158,6 +245,10 @@ class List {
 
 };
 
+// List whose nodes come from its own fixed pool of N blocks
+template<typename T, PoolSize_t N>
+using PooledList = List<T, StaticPool<__List::ListNode<T>, N>>;
+
 } // end namespace DataStructures
 
 #endif // __LIST_TPP__
\ No newline at end of file
@@ -0,0 +1,194 @@
+/**
+ ********************************************************************************
+ * @file    PriorityQueue.tpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Fixed-Capacity Binary Heap Priority Queue Template Implementation
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __PRIORITY_QUEUE_TPP__
+#define __PRIORITY_QUEUE_TPP__
+
+#include <stdlib.h>
+
+#include "Utility.tpp"
+
+namespace DataStructures {
+
+using PriorityQueueSize_t = unsigned int;
+using PriorityQueueHandle_t = PriorityQueueSize_t;
+
+const PriorityQueueHandle_t PRIORITY_QUEUE_INVALID = (PriorityQueueHandle_t)-1;
+
+// Compare(a, b) is true when a must leave the queue before b.
+//
+// Elements stay in fixed slots and the heap orders slot numbers, so the
+// handle returned by push() follows its element through every sift. That
+// is what lets update() and erase() reach an element in O(log n) without
+// searching for it.
+template<typename T, typename Compare, PriorityQueueSize_t N>
+class PriorityQueue {
+
+    static_assert(N > 0, "PriorityQueue must hold at least one element");
+
+    public:
+
+        PriorityQueue(const Compare &compare = Compare()) : compare(compare) {
+            heap_size = 0;
+            free_slots = 0;
+            overflow_count = 0;
+            for (PriorityQueueSize_t slot = 0; slot < N; slot++) position[slot] = PRIORITY_QUEUE_INVALID;
+        }
+        ~PriorityQueue() {
+            clear();
+        }
+
+        // Handles given out index this queue's slots, so a copy would alias them
+        PriorityQueue(const PriorityQueue &) = delete;
+        PriorityQueue &operator=(const PriorityQueue &) = delete;
+
+        inline PriorityQueueHandle_t push(const T &data) { return emplace(data); }
+        inline PriorityQueueHandle_t push(T &&data) { return emplace(Move(data)); }
+
+        template<typename... Args>
+        PriorityQueueHandle_t emplace(Args&&... args) {
+            if (full()) {
+                overflow_count++;
+                return PRIORITY_QUEUE_INVALID;
+            }
+            PriorityQueueHandle_t slot = Allocate();
+            new (Slot(slot)) T(Forward<Args>(args)...);
+            heap[heap_size] = slot;
+            position[slot] = heap_size;
+            SiftUp(heap_size++);
+            return slot;
+        }
+
+        bool pop(T& data) {
+            if (empty()) return false;
+            data = Move(*Slot(heap[0]));
+            Remove(heap[0]);
+            return true;
+        }
+        inline T pop() {
+            if (empty()) return T();
+            T data(Move(*Slot(heap[0])));
+            Remove(heap[0]);
+            return data;
+        }
+
+        inline T& top() { return *Slot(heap[0]); }
+        inline PriorityQueueHandle_t top_handle() { return empty() ? PRIORITY_QUEUE_INVALID : heap[0]; }
+
+        inline bool contains(PriorityQueueHandle_t handle) {
+            return handle < N && position[handle] != PRIORITY_QUEUE_INVALID;
+        }
+        inline T& get(PriorityQueueHandle_t handle) { return *Slot(handle); }
+
+        // Restore order after the element behind handle was changed through get()
+        bool update(PriorityQueueHandle_t handle) {
+            if (!contains(handle)) return false;
+            PriorityQueueSize_t index = position[handle];
+            SiftUp(index);
+            if (position[handle] == index) SiftDown(index);
+            return true;
+        }
+        bool update(PriorityQueueHandle_t handle, const T &data) {
+            if (!contains(handle)) return false;
+            *Slot(handle) = data;
+            return update(handle);
+        }
+
+        bool erase(PriorityQueueHandle_t handle) {
+            if (!contains(handle)) return false;
+            Remove(handle);
+            return true;
+        }
+
+        void clear() {
+            while (!empty()) Remove(heap[heap_size - 1]);
+        }
+
+        inline PriorityQueueSize_t size() { return heap_size; }
+        inline bool empty() { return heap_size == 0; }
+        inline bool full() { return heap_size == N; }
+        inline PriorityQueueSize_t capacity() { return N; }
+
+        // Pushes rejected because the queue was full
+        inline unsigned long overflows() { return overflow_count; }
+
+    private:
+
+        inline T* Slot(PriorityQueueHandle_t slot) { return reinterpret_cast<T*>(slots[slot]); }
+
+        // Slots past free_slots have never been used; the rest of the free
+        // ones sit in the heap array beyond heap_size
+        PriorityQueueHandle_t Allocate() {
+            if (free_slots > 0) return heap[N - free_slots--];
+            return heap_size;
+        }
+        void Release(PriorityQueueHandle_t slot) {
+            heap[N - ++free_slots] = slot;
+        }
+
+        void Remove(PriorityQueueHandle_t slot) {
+            PriorityQueueSize_t index = position[slot];
+            Slot(slot)->~T();
+            position[slot] = PRIORITY_QUEUE_INVALID;
+
+            PriorityQueueHandle_t last = heap[--heap_size];
+            if (index < heap_size) {
+                Place(index, last);
+                SiftUp(index);
+                if (heap[index] == last) SiftDown(index);
+            }
+            Release(slot);
+        }
+
+        inline void Place(PriorityQueueSize_t index, PriorityQueueHandle_t slot) {
+            heap[index] = slot;
+            position[slot] = index;
+        }
+
+        void SiftUp(PriorityQueueSize_t index) {
+            PriorityQueueHandle_t slot = heap[index];
+            while (index > 0) {
+                PriorityQueueSize_t parent = (index - 1) / 2;
+                if (!compare(*Slot(slot), *Slot(heap[parent]))) break;
+                Place(index, heap[parent]);
+                index = parent;
+            }
+            Place(index, slot);
+        }
+        void SiftDown(PriorityQueueSize_t index) {
+            PriorityQueueHandle_t slot = heap[index];
+            while (true) {
+                PriorityQueueSize_t child = 2 * index + 1;
+                if (child >= heap_size) break;
+                if (child + 1 < heap_size && compare(*Slot(heap[child + 1]), *Slot(heap[child]))) child++;
+                if (!compare(*Slot(heap[child]), *Slot(slot))) break;
+                Place(index, heap[child]);
+                index = child;
+            }
+            Place(index, slot);
+        }
+
+        Compare compare;
+
+        alignas(T) unsigned char slots[N][sizeof(T)];
+        PriorityQueueHandle_t heap[N];
+        PriorityQueueSize_t position[N];
+
+        PriorityQueueSize_t heap_size;
+        PriorityQueueSize_t free_slots;
+        unsigned long overflow_count;
+
+};
+
+} // end namespace DataStructures
+
+#endif // __PRIORITY_QUEUE_TPP__
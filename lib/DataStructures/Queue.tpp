@@ -15,12 +15,18 @@
 
 #include <stdlib.h>
 
+#include "Allocator.tpp"
+#include "Utility.tpp"
+
 namespace DataStructures {
 
 namespace __Queue {
 
 template<typename _T>
 struct QueueNode {
+    template<typename... _Args>
+    QueueNode(_Args&&... args) : next(NULL), data(Forward<_Args>(args)...) {}
+
     QueueNode<_T> *next;
     _T data;
 };
@@ -29,7 +35,7 @@ struct QueueNode {
 
 using QueueSize_t = unsigned int;
 
-template<typename T>
+template<typename T, typename Allocator = HeapAllocator<__Queue::QueueNode<T>>>
 class Queue {
 
     using QueueNode = __Queue::QueueNode<T>;
@@ -41,42 +47,38 @@ class Queue {
             queue_size = 0;
         }
         ~Queue() {
-            T temp;
-            while (queue_size > 0) pop(temp);
+            while (queue_size > 0) Remove();
         }
 
-        void push(T data) {
+        inline bool push(const T &data) { return emplace(data); }
+        inline bool push(T &&data) { return emplace(Move(data)); }
+
+        // Construct the element directly in its node
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            void *memory = allocator.allocate();
+            if (memory == NULL) return false;
+            QueueNode *new_node = new (memory) QueueNode(Forward<Args>(args)...);
             if (queue_size == 0) {
-                head = new QueueNode;
-                head->data = data;
-                head->next = head;
+                new_node->next = new_node;
             }
             else {
-                QueueNode *new_node = new QueueNode; 
-                new_node->data = data;
                 new_node->next = head->next;
                 head->next = new_node;
-                head = new_node; 
             }
+            head = new_node;
             queue_size++;
+            return true;
         }
         void pop(T& data) {
             if (queue_size == 0) return;
-            data = head->next->data;
-            queue_size--;
-            if (queue_size == 0) {
-                delete head;
-                head = NULL;
-            }
-            else {
-                QueueNode *rm = head->next;
-                head->next = rm->next;
-                delete rm;
-            }
+            data = Move(head->next->data);
+            Remove();
         }
         inline T pop() {
-            T data;
-            pop(data);
+            if (queue_size == 0) return T();
+            T data(Move(head->next->data));
+            Remove();
             return data;
         }
         inline T& peek() { return head->next->data; }
@@ -84,13 +86,30 @@ class Queue {
         inline QueueSize_t size() { return queue_size; }
         inline bool empty() { return queue_size == 0; }
 
+        inline Allocator& get_allocator() { return allocator; }
+
     private:
 
+        void Remove() {
+            QueueNode *rm = head->next;
+            queue_size--;
+            if (queue_size == 0) head = NULL;
+            else head->next = rm->next;
+            rm->~QueueNode();
+            allocator.deallocate(rm);
+        }
+
+        Allocator allocator;
+
         QueueNode *head;
         QueueSize_t queue_size;
 
 };
 
+// Queue whose nodes come from its own fixed pool of N blocks
+template<typename T, PoolSize_t N>
+using PooledQueue = Queue<T, StaticPool<__Queue::QueueNode<T>, N>>;
+
 } // end namespace DataStructures
 
 #endif // __LIST_HPP__
\ No newline at end of file
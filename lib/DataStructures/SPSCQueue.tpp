@@ -0,0 +1,125 @@
+/**
+ ********************************************************************************
+ * @file    SPSCQueue.tpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Lock-Free Single-Producer Single-Consumer Queue Template Implementation
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __SPSC_QUEUE_TPP__
+#define __SPSC_QUEUE_TPP__
+
+#include <stdint.h>
+
+#ifndef ARDUINO
+#include <atomic>
+#endif
+
+#include "Queue.tpp"
+
+namespace DataStructures {
+
+// One context pushes (an ISR or an RX thread) and one context pops (the main
+// loop). The producer only writes tail and the consumer only writes head, so
+// neither side needs a lock or to mask interrupts. On AVR the indices are
+// single bytes, which the core loads and stores atomically.
+template<typename T, QueueSize_t N>
+class SPSCQueue {
+
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SPSCQueue capacity must be a power of two");
+
+#ifdef ARDUINO
+    static_assert(N <= 128, "SPSCQueue capacity must fit a single-byte index on Arduino");
+    using Index_t = uint8_t;
+#else
+    using Index_t = QueueSize_t;
+#endif
+
+    static const Index_t MASK = N - 1;
+
+    public:
+
+        SPSCQueue() : head(0), tail(0), overflow_count(0) {}
+        ~SPSCQueue() {}
+
+        // Producer side
+        bool push(const T &data) {
+            Index_t t = LoadRelaxed(tail);
+            if ((Index_t)(t - LoadAcquire(head)) == N) {
+                overflow_count++;
+                return false;
+            }
+            buffer[t & MASK] = data;
+            StoreRelease(tail, t + 1);
+            return true;
+        }
+
+        // Consumer side
+        bool pop(T &data) {
+            Index_t h = LoadRelaxed(head);
+            if (h == LoadAcquire(tail)) return false;
+            data = buffer[h & MASK];
+            StoreRelease(head, h + 1);
+            return true;
+        }
+        inline T pop() {
+            T data;
+            pop(data);
+            return data;
+        }
+        bool peek(T &data) {
+            Index_t h = LoadRelaxed(head);
+            if (h == LoadAcquire(tail)) return false;
+            data = buffer[h & MASK];
+            return true;
+        }
+
+        // Either side; the answer may be stale by the time it is used
+        inline QueueSize_t size() { return (Index_t)(LoadAcquire(tail) - LoadAcquire(head)); }
+        inline bool empty() { return size() == 0; }
+        inline bool full() { return size() == N; }
+        inline QueueSize_t capacity() { return N; }
+
+        // Pushes rejected because the queue was full
+        inline unsigned long overflows() { return overflow_count; }
+
+    private:
+
+        T buffer[N];
+
+#ifdef ARDUINO
+        volatile Index_t head;
+        volatile Index_t tail;
+        volatile unsigned long overflow_count;
+
+        // The volatile accesses are atomic; the barrier keeps the buffer access
+        // from being reordered across the index update
+        static inline Index_t LoadRelaxed(volatile Index_t &index) { return index; }
+        static inline Index_t LoadAcquire(volatile Index_t &index) {
+            Index_t value = index;
+            __asm__ __volatile__("" ::: "memory");
+            return value;
+        }
+        static inline void StoreRelease(volatile Index_t &index, Index_t value) {
+            __asm__ __volatile__("" ::: "memory");
+            index = value;
+        }
+#else
+        std::atomic<Index_t> head;
+        std::atomic<Index_t> tail;
+        std::atomic<unsigned long> overflow_count;
+
+        static inline Index_t LoadRelaxed(std::atomic<Index_t> &index) { return index.load(std::memory_order_relaxed); }
+        static inline Index_t LoadAcquire(std::atomic<Index_t> &index) { return index.load(std::memory_order_acquire); }
+        static inline void StoreRelease(std::atomic<Index_t> &index, Index_t value) { index.store(value, std::memory_order_release); }
+#endif
+
+};
+
+} // end namespace DataStructures
+
+#endif // __SPSC_QUEUE_TPP__
@@ -0,0 +1,100 @@
+/**
+ ********************************************************************************
+ * @file    StaticQueue.tpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Fixed-Capacity Ring Buffer Queue Template Implementation
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __STATIC_QUEUE_TPP__
+#define __STATIC_QUEUE_TPP__
+
+#include "Queue.tpp"
+#include "Utility.tpp"
+
+namespace DataStructures {
+
+// Head and tail run freely and are masked on access, so size() is a single
+// subtraction that stays correct across index wraparound
+template<typename T, QueueSize_t N>
+class StaticQueue {
+
+    static_assert(N > 0 && (N & (N - 1)) == 0, "StaticQueue capacity must be a power of two");
+    static_assert(N <= ((QueueSize_t)-1 >> 1) + 1, "StaticQueue capacity exceeds the index range");
+
+    static const QueueSize_t MASK = N - 1;
+
+    public:
+
+        StaticQueue() {
+            head = 0;
+            tail = 0;
+            overflow_count = 0;
+        }
+        ~StaticQueue() {
+            while (!empty()) Remove();
+        }
+
+        // Slots are raw storage, which a member-wise copy would not construct
+        StaticQueue(const StaticQueue &) = delete;
+        StaticQueue &operator=(const StaticQueue &) = delete;
+
+        inline bool push(const T &data) { return emplace(data); }
+        inline bool push(T &&data) { return emplace(Move(data)); }
+
+        // Slots are raw storage, so elements are built in place and T needs
+        // no default constructor
+        template<typename... Args>
+        bool emplace(Args&&... args) {
+            if (full()) {
+                overflow_count++;
+                return false;
+            }
+            new (Slot(tail)) T(Forward<Args>(args)...);
+            tail++;
+            return true;
+        }
+        bool pop(T& data) {
+            if (empty()) return false;
+            data = Move(*Slot(head));
+            Remove();
+            return true;
+        }
+        inline T pop() {
+            if (empty()) return T();
+            T data(Move(*Slot(head)));
+            Remove();
+            return data;
+        }
+        inline T& peek() { return *Slot(head); }
+
+        inline QueueSize_t size() { return tail - head; }
+        inline bool empty() { return tail == head; }
+        inline bool full() { return (QueueSize_t)(tail - head) == N; }
+        inline QueueSize_t capacity() { return N; }
+
+        // Pushes rejected because the queue was full
+        inline unsigned long overflows() { return overflow_count; }
+
+    private:
+
+        inline T* Slot(QueueSize_t index) { return reinterpret_cast<T*>(buffer[index & MASK]); }
+        inline void Remove() {
+            Slot(head)->~T();
+            head++;
+        }
+
+        alignas(T) unsigned char buffer[N][sizeof(T)];
+        QueueSize_t head;
+        QueueSize_t tail;
+        unsigned long overflow_count;
+
+};
+
+} // end namespace DataStructures
+
+#endif // __STATIC_QUEUE_TPP__
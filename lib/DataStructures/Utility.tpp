@@ -0,0 +1,49 @@
+/**
+ ********************************************************************************
+ * @file    Utility.tpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Move and Forward Helpers for Toolchains Without <utility>
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __UTILITY_TPP__
+#define __UTILITY_TPP__
+
+#ifdef ARDUINO
+#include <new.h>
+#else
+#include <new>
+#endif
+
+namespace DataStructures {
+
+namespace __Utility {
+
+template<typename _T> struct RemoveReference { typedef _T type; };
+template<typename _T> struct RemoveReference<_T&> { typedef _T type; };
+template<typename _T> struct RemoveReference<_T&&> { typedef _T type; };
+
+} // end namespace __Utility
+
+// Equivalents of std::move and std::forward; avr-libc ships no <utility>
+template<typename T>
+inline typename __Utility::RemoveReference<T>::type&& Move(T&& value) {
+    return static_cast<typename __Utility::RemoveReference<T>::type&&>(value);
+}
+
+template<typename T>
+inline T&& Forward(typename __Utility::RemoveReference<T>::type& value) {
+    return static_cast<T&&>(value);
+}
+template<typename T>
+inline T&& Forward(typename __Utility::RemoveReference<T>::type&& value) {
+    return static_cast<T&&>(value);
+}
+
+} // end namespace DataStructures
+
+#endif // __UTILITY_TPP__
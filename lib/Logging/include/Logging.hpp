@@ -0,0 +1,75 @@
+/**
+ ********************************************************************************
+ * @file    Logging.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Deferred Binary Logging
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __LOGGING_HPP__
+#define __LOGGING_HPP__
+
+#include <stdint.h>
+
+#include "Logging_Configuration.hpp"
+#include "Logging_Messages.hpp"
+
+namespace Logging {
+
+struct Record {
+    uint32_t timestamp;
+    Message message;
+    uint8_t level;
+    uint8_t argument_count;
+    int32_t arguments[LOG_MAX_ARGUMENTS];
+};
+
+void Push(uint8_t level, Message message, const int32_t *arguments, uint8_t argument_count);
+
+template<typename... Args>
+inline void Write(uint8_t level, Message message, Args... args) {
+    static_assert(sizeof...(Args) <= LOG_MAX_ARGUMENTS, "Too many log arguments");
+    const int32_t arguments[] = {0, (int32_t)args...};
+    Push(level, message, &arguments[1], sizeof...(Args));
+}
+
+unsigned int Flush(unsigned int count = 0);
+unsigned long Dropped();
+
+} // end namespace Logging
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(message, ...) ::Logging::Write(LOG_LEVEL_ERROR, ::Logging::Message::message, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(message, ...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARNING
+#define LOG_WARNING(message, ...) ::Logging::Write(LOG_LEVEL_WARNING, ::Logging::Message::message, ##__VA_ARGS__)
+#else
+#define LOG_WARNING(message, ...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(message, ...) ::Logging::Write(LOG_LEVEL_INFO, ::Logging::Message::message, ##__VA_ARGS__)
+#else
+#define LOG_INFO(message, ...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(message, ...) ::Logging::Write(LOG_LEVEL_DEBUG, ::Logging::Message::message, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(message, ...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_TRACE
+#define LOG_TRACE(message, ...) ::Logging::Write(LOG_LEVEL_TRACE, ::Logging::Message::message, ##__VA_ARGS__)
+#else
+#define LOG_TRACE(message, ...) ((void)0)
+#endif
+
+#endif // __LOGGING_HPP__
@@ -0,0 +1,39 @@
+/**
+ ********************************************************************************
+ * @file    Logging_Configuration.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Logging Configuration for Arduino MEGA 2560
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __LOGGING_CONFIGURATION_HPP__
+#define __LOGGING_CONFIGURATION_HPP__
+
+#include <Platform.hpp>
+
+// Severity Levels
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARNING 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+#define LOG_LEVEL_TRACE 5
+
+// Messages above this level compile to nothing
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Serial USART Allocation
+#define LOG_OUTPUT PLATFORM_DEBUG_CONSOLE
+
+// Record Buffer Settings
+#define LOG_BUFFER_LENGTH 16
+#define LOG_MAX_ARGUMENTS 3
+#define LOG_SYNC_BYTE 0xA5
+
+#endif // __LOGGING_CONFIGURATION_HPP__
@@ -0,0 +1,54 @@
+/**
+ ********************************************************************************
+ * @file    Logging_Messages.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Log Message Catalog
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __LOGGING_MESSAGES_HPP__
+#define __LOGGING_MESSAGES_HPP__
+
+#include <stdint.h>
+
+// Message IDs are assigned in order; tools/log_decoder.py reads the
+// format strings from this list, so only append to keep old logs decodable.
+#define LOG_MESSAGES(MESSAGE) \
+    MESSAGE(LOG_RECORDS_DROPPED,             "%lu log records dropped") \
+    MESSAGE(SM_REGISTERED_FUNCTION,          "Registered function task %u: period %luus, priority %u") \
+    MESSAGE(SM_REGISTERED_PROCESS,           "Registered process task %u: period %luus, priority %u") \
+    MESSAGE(SM_SCAN,                         "Iterating through %u tasks") \
+    MESSAGE(SM_WEIGHTED_PRIORITY,            "Task %u: %luus overdue, weighted priority %lu") \
+    MESSAGE(SM_CALL_FUNCTION,                "Calling function task %u") \
+    MESSAGE(SM_CALL_PROCESS,                 "Calling process task %u") \
+    MESSAGE(SM_PROCESS_REGISTERED_FUNCTION,  "Registered function %u to process") \
+    MESSAGE(SM_ADMISSION_REJECTED,           "Admission control rejected task %u") \
+    MESSAGE(SM_ADMISSION_OVERLOAD,           "Admitted task %u beyond the schedulable load") \
+    MESSAGE(SM_INVALID_PERIOD,               "Task %u: periodic scheduling needs a nonzero period") \
+    MESSAGE(SM_UTILIZATION_EXCEEDED,         "Utilization %lu ppm exceeds the processor") \
+    MESSAGE(SM_RESPONSE_TIME_EXCEEDED,       "Task %u: worst-case response %luus exceeds period %luus") \
+    MESSAGE(SM_RELEASES_SKIPPED,             "Task %u: skipped %lu missed releases") \
+    MESSAGE(SM_PROCESS_REGISTERED_COROUTINE, "Registered coroutine %u to process") \
+    MESSAGE(SM_TASK_TABLE_FULL,              "Task table full at %u tasks") \
+    MESSAGE(SM_PROCESS_FULL,                 "Process full at %u functions") \
+    MESSAGE(SM_EVENT_BOUND,                  "Event %u bound to task %u") \
+    MESSAGE(SM_INVALID_EVENT,                "Cannot bind event %u to task %u") \
+    MESSAGE(SM_EVENT_DISPATCH,               "Event %u: calling task %u") \
+    MESSAGE(TELECOM_TRANSMIT_FLUSHED,        "Transmit queue full %lu times; sent the oldest frame early")
+
+namespace Logging {
+
+enum class Message : uint8_t {
+#define LOG_MESSAGE_ID(id, format) id,
+    LOG_MESSAGES(LOG_MESSAGE_ID)
+#undef LOG_MESSAGE_ID
+    MESSAGE_COUNT
+};
+
+} // end namespace Logging
+
+#endif // __LOGGING_MESSAGES_HPP__
@@ -0,0 +1,125 @@
+/**
+ ********************************************************************************
+ * @file    Logging.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Deferred Binary Logging
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Logging.hpp"
+
+#include <stdint.h>
+
+#include <Platform.hpp>
+
+#include "Logging_Configuration.hpp"
+#include "Logging_Messages.hpp"
+
+namespace Logging {
+
+namespace {
+
+Record Records[LOG_BUFFER_LENGTH];
+uint8_t RecordHead = 0;
+uint8_t RecordCount = 0;
+
+unsigned long DroppedTotal = 0;
+unsigned long DroppedPending = 0;
+
+void WriteWord(uint8_t *ptr, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        ptr[i] = (value >> (8 * i)) & 0xFF;
+    }
+}
+
+// Frame: SYNC | MESSAGE | LEVEL | ARGC | TIMESTAMP (LE32) | ARGUMENTS (LE32 x ARGC)
+bool WriteRecord(const Record &record) {
+    uint8_t frame[8 + 4 * LOG_MAX_ARGUMENTS];
+    unsigned int length = 8 + 4 * record.argument_count;
+    if ((unsigned int)LOG_OUTPUT.availableForWrite() < length) return false;
+
+    frame[0] = LOG_SYNC_BYTE;
+    frame[1] = (uint8_t)record.message;
+    frame[2] = record.level;
+    frame[3] = record.argument_count;
+    WriteWord(&frame[4], record.timestamp);
+    for (uint8_t i = 0; i < record.argument_count; i++) {
+        WriteWord(&frame[8 + 4 * i], record.arguments[i]);
+    }
+
+    LOG_OUTPUT.write(frame, length);
+    return true;
+}
+
+} // end namespace
+
+void Push(uint8_t level, Message message, const int32_t *arguments, uint8_t argument_count) {
+    Platform::CriticalSection critical;
+
+    if (RecordCount == LOG_BUFFER_LENGTH) {
+        DroppedTotal++;
+        DroppedPending++;
+        return;
+    }
+
+    Record &record = Records[(RecordHead + RecordCount) % LOG_BUFFER_LENGTH];
+    record.timestamp = Platform::Clock::Millis();
+    record.message = message;
+    record.level = level;
+    record.argument_count = argument_count;
+    for (uint8_t i = 0; i < argument_count; i++) {
+        record.arguments[i] = arguments[i];
+    }
+    RecordCount++;
+}
+
+unsigned int Flush(unsigned int count) {
+    unsigned int written = 0;
+
+    // Report Overflow before the Records that survived it
+    unsigned long dropped_pending;
+    {
+        Platform::CriticalSection critical;
+        dropped_pending = DroppedPending;
+    }
+    if (dropped_pending > 0) {
+        Record dropped;
+        dropped.timestamp = Platform::Clock::Millis();
+        dropped.message = Message::LOG_RECORDS_DROPPED;
+        dropped.level = LOG_LEVEL_WARNING;
+        dropped.argument_count = 1;
+        dropped.arguments[0] = dropped_pending;
+        if (!WriteRecord(dropped)) return written;
+
+        Platform::CriticalSection critical;
+        DroppedPending -= dropped_pending;
+    }
+
+    // Records are copied out so producers are only held off for the copy
+    while (count == 0 || written < count) {
+        Record record;
+        {
+            Platform::CriticalSection critical;
+            if (RecordCount == 0) break;
+            record = Records[RecordHead];
+        }
+        if (!WriteRecord(record)) break;
+
+        Platform::CriticalSection critical;
+        RecordHead = (RecordHead + 1) % LOG_BUFFER_LENGTH;
+        RecordCount--;
+        written++;
+    }
+
+    return written;
+}
+
+unsigned long Dropped() {
+    return DroppedTotal;
+}
+
+} // end namespace Logging
@@ -0,0 +1,87 @@
+/**
+ ********************************************************************************
+ * @file    Platform.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Hardware Abstraction for Clock and Console Access
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __PLATFORM_HPP__
+#define __PLATFORM_HPP__
+
+#include "Platform_Configuration.hpp"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#ifdef __AVR__
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#endif
+#else
+#include "Platform_Host.hpp"
+#endif
+
+namespace Platform {
+
+namespace Clock {
+
+#ifdef ARDUINO
+inline unsigned long Millis() { return ::millis(); }
+inline unsigned long Micros() { return ::micros(); }
+#else
+unsigned long Millis();
+unsigned long Micros();
+#endif
+
+} // end namespace Clock
+
+// Idle the core for at most max_us; Wake() ends a pending or current Idle early
+#ifdef ARDUINO
+inline void Idle(unsigned long max_us) {
+#ifdef __AVR__
+    // IDLE keeps timers and USARTs running; the Timer0 overflow (prescaler 64)
+    // wakes the core every 1.024 ms, so a shorter request must not sleep at all
+    const unsigned long timer0_tick_us = (64UL * 256UL) / (F_CPU / 1000000UL);
+    if (max_us < timer0_tick_us) return;
+
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sleep_enable();
+    sleep_cpu();
+    sleep_disable();
+#endif
+}
+inline void Wake() {}
+#else
+void Idle(unsigned long max_us);
+void Wake();
+#endif
+
+// Scoped exclusion against ISRs on AVR and against other threads on the host
+#ifdef ARDUINO
+class CriticalSection {
+    public:
+#ifdef __AVR__
+        CriticalSection() : sreg(SREG) { cli(); }
+        ~CriticalSection() { SREG = sreg; }
+    private:
+        uint8_t sreg;
+#else
+        CriticalSection() {}
+        ~CriticalSection() {}
+#endif
+};
+#else
+class CriticalSection {
+    public:
+        CriticalSection();
+        ~CriticalSection();
+};
+#endif
+
+} // end namespace Platform
+
+#endif // __PLATFORM_HPP__
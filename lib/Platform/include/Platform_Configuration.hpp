@@ -0,0 +1,35 @@
+/**
+ ********************************************************************************
+ * @file    Platform_Configuration.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Platform Configuration for Arduino MEGA 2560 and Linux Host
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __PLATFORM_CONFIGURATION_HPP__
+#define __PLATFORM_CONFIGURATION_HPP__
+
+// Serial USART Allocation
+#ifdef ARDUINO
+#define PLATFORM_DEBUG_CONSOLE Serial
+#define PLATFORM_TELECOM_CONSOLE Serial1
+#else
+#define PLATFORM_DEBUG_CONSOLE ::Platform::Host::DebugConsole
+#define PLATFORM_TELECOM_CONSOLE ::Platform::Host::TelecomConsole
+#endif
+
+// Host Console Settings
+#define PLATFORM_HOST_RX_BUFFER 1024
+#define PLATFORM_HOST_TX_AVAILABLE 64
+
+// Stack below the caller of Memory::PaintStack() watched for high-water use
+#define PLATFORM_HOST_STACK_PAINT 65536
+
+// Virtual time charged to each pass through the host main loop
+#define PLATFORM_HOST_LOOP_US 20
+
+#endif // __PLATFORM_CONFIGURATION_HPP__
@@ -0,0 +1,102 @@
+/**
+ ********************************************************************************
+ * @file    Platform_Host.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Linux Host Backend with a Virtual Clock
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __PLATFORM_HOST_HPP__
+#define __PLATFORM_HOST_HPP__
+
+#ifndef ARDUINO
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <SPSCQueue.tpp>
+
+#include "Platform_Configuration.hpp"
+
+namespace Platform {
+
+namespace Clock {
+
+enum class ClockMode {
+    VIRTUAL,
+    REALTIME
+};
+
+// Virtual time only moves when advanced, so simulations run as fast as
+// the host can execute them; REALTIME follows the host monotonic clock.
+void SetMode(ClockMode mode);
+ClockMode Mode();
+
+void Advance(uint64_t us);
+void Set(uint64_t us);
+uint64_t Now();
+
+} // end namespace Clock
+
+namespace Host {
+
+// Subset of the Arduino Stream/Print interface used by the CORALS libraries
+class Console {
+    public:
+        Console();
+        ~Console();
+
+        void begin(unsigned long baud);
+        void end();
+
+        int available();
+        int read();
+        int peek();
+        size_t readBytes(uint8_t *buffer, size_t length);
+        void Inject(const uint8_t *buffer, size_t length);
+
+        int availableForWrite();
+        size_t write(uint8_t byte);
+        size_t write(const uint8_t *buffer, size_t length);
+        void flush();
+        void SetOutput(FILE *output);
+
+        size_t print(const char *string);
+        size_t print(char c);
+        size_t print(long value, int base = 10);
+        size_t print(unsigned long value, int base = 10);
+        size_t print(int value, int base = 10);
+        size_t print(unsigned int value, int base = 10);
+        size_t print(double value, int digits = 2);
+        size_t println();
+        template<typename T>
+        size_t println(T value) { return print(value) + println(); }
+
+    private:
+        DataStructures::SPSCQueue<uint8_t, PLATFORM_HOST_RX_BUFFER> rx_queue;
+        FILE *output;
+
+};
+
+extern Console DebugConsole;
+extern Console TelecomConsole;
+
+} // end namespace Host
+
+} // end namespace Platform
+
+// AVR libc compatibility
+char *dtostrf(double value, signed char width, unsigned char precision, char *buffer);
+
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+
+#endif // ARDUINO
+
+#endif // __PLATFORM_HOST_HPP__
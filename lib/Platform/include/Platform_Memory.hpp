@@ -0,0 +1,68 @@
+/**
+ ********************************************************************************
+ * @file    Platform_Memory.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Heap and Stack Instrumentation
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __PLATFORM_MEMORY_HPP__
+#define __PLATFORM_MEMORY_HPP__
+
+#include "Platform_Configuration.hpp"
+
+namespace Platform {
+
+namespace Memory {
+
+// Bytes the allocator could still hand out, counting its free list
+unsigned long FreeHeap();
+unsigned long LargestFreeBlock();
+
+// Deepest stack use seen since the stack was painted, in bytes. AVR paints
+// everything above the static data at reset; the host paints
+// PLATFORM_HOST_STACK_PAINT bytes below the caller of PaintStack().
+void PaintStack();
+unsigned long StackHighWater();
+
+// Allocation bookkeeping for one subsystem. Counters chain themselves into
+// a list when constructed, so telemetry can walk every subsystem.
+class Counter {
+    public:
+        Counter(const char *name);
+
+        inline void Allocated() {
+            allocations++;
+            live++;
+            if (live > peak) peak = live;
+        }
+        inline void Freed() {
+            if (live > 0) live--;
+        }
+
+        inline const char* Name() const { return name; }
+        inline unsigned long Allocations() const { return allocations; }
+        inline unsigned long Live() const { return live; }
+        inline unsigned long Peak() const { return peak; }
+
+        inline Counter* Next() const { return next; }
+        static Counter* First();
+
+    private:
+        const char *name;
+        unsigned long allocations;
+        unsigned long live;
+        unsigned long peak;
+
+        Counter *next;
+};
+
+} // end namespace Memory
+
+} // end namespace Platform
+
+#endif // __PLATFORM_MEMORY_HPP__
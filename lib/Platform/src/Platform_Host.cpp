@@ -0,0 +1,219 @@
+/**
+ ********************************************************************************
+ * @file    Platform_Host.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Linux Host Backend with a Virtual Clock
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef ARDUINO
+
+#include "Platform_Host.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "Platform.hpp"
+#include "Platform_Configuration.hpp"
+
+namespace Platform {
+
+namespace Clock {
+
+namespace {
+
+std::atomic<uint64_t> VirtualTime(0);
+ClockMode CurrentMode = ClockMode::VIRTUAL;
+std::chrono::steady_clock::time_point RealtimeEpoch = std::chrono::steady_clock::now();
+
+} // end namespace
+
+void SetMode(ClockMode mode) {
+    CurrentMode = mode;
+    RealtimeEpoch = std::chrono::steady_clock::now();
+}
+
+ClockMode Mode() {
+    return CurrentMode;
+}
+
+void Advance(uint64_t us) {
+    VirtualTime += us;
+}
+
+void Set(uint64_t us) {
+    VirtualTime = us;
+}
+
+uint64_t Now() {
+    if (CurrentMode == ClockMode::REALTIME) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - RealtimeEpoch).count();
+    }
+    return VirtualTime;
+}
+
+unsigned long Millis() {
+    return Now() / 1000;
+}
+
+unsigned long Micros() {
+    return Now();
+}
+
+} // end namespace Clock
+
+namespace {
+
+std::recursive_mutex CriticalMutex;
+std::mutex WakeMutex;
+std::condition_variable WakeCondition;
+bool WakePending = false;
+
+} // end namespace
+
+CriticalSection::CriticalSection() {
+    CriticalMutex.lock();
+}
+
+CriticalSection::~CriticalSection() {
+    CriticalMutex.unlock();
+}
+
+void Idle(unsigned long max_us) {
+    std::unique_lock<std::mutex> lock(WakeMutex);
+
+    // Virtual time skips straight to the deadline unless a wake is already pending
+    if (Clock::Mode() == Clock::ClockMode::VIRTUAL) {
+        if (!WakePending) Clock::Advance(max_us);
+    }
+    else {
+        WakeCondition.wait_for(lock, std::chrono::microseconds(max_us), [] { return WakePending; });
+    }
+    WakePending = false;
+}
+
+void Wake() {
+    std::lock_guard<std::mutex> lock(WakeMutex);
+    WakePending = true;
+    WakeCondition.notify_all();
+}
+
+namespace Host {
+
+Console DebugConsole;
+Console TelecomConsole;
+
+Console::Console() : output(NULL) {}
+Console::~Console() {}
+
+void Console::begin(unsigned long) {}
+void Console::end() {}
+
+int Console::available() {
+    return rx_queue.size();
+}
+
+int Console::read() {
+    uint8_t byte;
+    if (!rx_queue.pop(byte)) return -1;
+    return byte;
+}
+
+int Console::peek() {
+    uint8_t byte;
+    if (!rx_queue.peek(byte)) return -1;
+    return byte;
+}
+
+size_t Console::readBytes(uint8_t *buffer, size_t length) {
+    size_t count = 0;
+    while (count < length && rx_queue.pop(buffer[count])) count++;
+    return count;
+}
+
+// Safe to call from one producer thread while the main loop reads
+void Console::Inject(const uint8_t *buffer, size_t length) {
+    for (size_t i = 0; i < length && rx_queue.push(buffer[i]); i++);
+    Wake();
+}
+
+int Console::availableForWrite() {
+    return PLATFORM_HOST_TX_AVAILABLE;
+}
+
+size_t Console::write(uint8_t byte) {
+    if (output != NULL) fputc(byte, output);
+    return 1;
+}
+
+size_t Console::write(const uint8_t *buffer, size_t length) {
+    if (output != NULL) fwrite(buffer, 1, length, output);
+    return length;
+}
+
+void Console::flush() {
+    if (output != NULL) fflush(output);
+}
+
+void Console::SetOutput(FILE *output) {
+    this->output = output;
+}
+
+size_t Console::print(const char *string) {
+    return write((const uint8_t *)string, strlen(string));
+}
+
+size_t Console::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t Console::print(long value, int base) {
+    char buffer[24];
+    snprintf(buffer, sizeof(buffer), (base == 16) ? "%lX" : "%ld", value);
+    return print(buffer);
+}
+
+size_t Console::print(unsigned long value, int base) {
+    char buffer[24];
+    snprintf(buffer, sizeof(buffer), (base == 16) ? "%lX" : "%lu", value);
+    return print(buffer);
+}
+
+size_t Console::print(int value, int base) {
+    return print((long)value, base);
+}
+
+size_t Console::print(unsigned int value, int base) {
+    return print((unsigned long)value, base);
+}
+
+size_t Console::print(double value, int digits) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+    return print(buffer);
+}
+
+size_t Console::println() {
+    return print("\r\n");
+}
+
+} // end namespace Host
+
+} // end namespace Platform
+
+char *dtostrf(double value, signed char width, unsigned char precision, char *buffer) {
+    sprintf(buffer, "%*.*f", width, precision, value);
+    return buffer;
+}
+
+#endif // ARDUINO
@@ -0,0 +1,174 @@
+/**
+ ********************************************************************************
+ * @file    Platform_Memory.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Heap and Stack Instrumentation
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Platform_Memory.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __AVR__
+#include <avr/io.h>
+#elif !defined(ARDUINO)
+#include <malloc.h>
+#endif
+
+#ifdef __AVR__
+
+// avr-libc allocator internals
+extern "C" {
+extern uint8_t _end;
+extern uint8_t __stack;
+extern char __heap_start;
+extern char *__brkval;
+extern size_t __malloc_margin;
+
+struct __freelist {
+    size_t sz;
+    struct __freelist *nx;
+};
+extern struct __freelist *__flp;
+}
+
+// Runs from .init1, before the stack pointer is set up, so it cannot touch
+// the stack or rely on r1 being zero
+void PlatformPaintStack() __attribute__((naked, used, section(".init1")));
+void PlatformPaintStack() {
+    __asm__ __volatile__ (
+        "    ldi r30, lo8(_end)\n"
+        "    ldi r31, hi8(_end)\n"
+        "    ldi r24, lo8(0xC5)\n"
+        "    ldi r25, hi8(__stack)\n"
+        "    rjmp 2f\n"
+        "1:\n"
+        "    st Z+, r24\n"
+        "2:\n"
+        "    cpi r30, lo8(__stack)\n"
+        "    cpc r31, r25\n"
+        "    brlo 1b\n"
+        "    breq 1b\n"
+    );
+}
+
+#endif
+
+namespace Platform {
+
+namespace Memory {
+
+namespace {
+
+const uint8_t STACK_PAINT = 0xC5;
+
+Counter *counters = NULL;
+
+} // end namespace
+
+Counter::Counter(const char *name) : name(name), allocations(0), live(0), peak(0), next(counters) {
+    counters = this;
+}
+
+Counter* Counter::First() {
+    return counters;
+}
+
+#if defined(__AVR__)
+
+namespace {
+
+inline uint8_t* HeapEnd() {
+    return (uint8_t *)((__brkval == NULL) ? &__heap_start : __brkval);
+}
+
+} // end namespace
+
+unsigned long FreeHeap() {
+    uint8_t top;
+    unsigned long free_bytes = (&top > HeapEnd()) ? &top - HeapEnd() : 0;
+    for (struct __freelist *block = __flp; block != NULL; block = block->nx) {
+        free_bytes += block->sz + sizeof(size_t);
+    }
+    return free_bytes;
+}
+
+unsigned long LargestFreeBlock() {
+    uint8_t top;
+    unsigned long gap = (&top > HeapEnd()) ? &top - HeapEnd() : 0;
+    unsigned long largest = (gap > __malloc_margin) ? gap - __malloc_margin : 0;
+    for (struct __freelist *block = __flp; block != NULL; block = block->nx) {
+        if (block->sz > largest) largest = block->sz;
+    }
+    return largest;
+}
+
+void PaintStack() {}
+
+// Heap blocks released back below __brkval leave unpainted bytes behind, so
+// this errs towards reporting more stack than was really used
+unsigned long StackHighWater() {
+    const uint8_t *p = HeapEnd();
+    while (p <= &__stack && *p == STACK_PAINT) p++;
+    return (p <= &__stack) ? &__stack - p + 1 : 0;
+}
+
+#elif defined(ARDUINO)
+
+unsigned long FreeHeap() { return 0; }
+unsigned long LargestFreeBlock() { return 0; }
+void PaintStack() {}
+unsigned long StackHighWater() { return 0; }
+
+#else
+
+namespace {
+
+// Addresses of the painted region, which outlives the frame that painted it
+uintptr_t stack_floor = 0;
+uintptr_t stack_base = 0;
+
+} // end namespace
+
+// glibc reports the free chunks it holds; the top chunk is the largest
+// block it can carve without asking the kernel for more
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+unsigned long FreeHeap() {
+    struct mallinfo2 info = mallinfo2();
+    return info.fordblks;
+}
+
+unsigned long LargestFreeBlock() {
+    struct mallinfo2 info = mallinfo2();
+    return info.keepcost;
+}
+#else
+unsigned long FreeHeap() { return 0; }
+unsigned long LargestFreeBlock() { return 0; }
+#endif
+
+__attribute__((noinline)) void PaintStack() {
+    volatile uint8_t region[PLATFORM_HOST_STACK_PAINT];
+    for (unsigned long i = 0; i < PLATFORM_HOST_STACK_PAINT; i++) region[i] = STACK_PAINT;
+    stack_floor = (uintptr_t)&region[0];
+    stack_base = (uintptr_t)&region[PLATFORM_HOST_STACK_PAINT - 1];
+}
+
+unsigned long StackHighWater() {
+    if (stack_floor == 0) return 0;
+    uintptr_t p = stack_floor;
+    while (p <= stack_base && *(const volatile uint8_t *)p == STACK_PAINT) p++;
+    return stack_base - p + 1;
+}
+
+#endif
+
+} // end namespace Memory
+
+} // end namespace Platform
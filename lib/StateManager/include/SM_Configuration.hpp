@@ -13,9 +13,39 @@
 #ifndef __STATEMANAGER_CONFIGURATION_HPP__
 #define __STATEMANAGER_CONFIGURATION_HPP__
 
-#include <Arduino.h>
+#include <Platform.hpp>
 
-// Serial USART Allocation
-#define SM_DEBUG Serial
+// Static Task Storage
+#ifndef SM_MAX_TASKS
+#define SM_MAX_TASKS 16
+#endif
+#ifndef SM_MAX_REGISTERED_TASKS
+#define SM_MAX_REGISTERED_TASKS 4
+#endif
+#ifndef SM_MAX_EVENTS
+#define SM_MAX_EVENTS 8
+#endif
+#ifndef SM_MAX_PROCESS_FUNCTIONS
+#define SM_MAX_PROCESS_FUNCTIONS 8
+#endif
+
+// Passes a budgeted process may make over its members in one slot
+#define SM_PROCESS_MAX_PASSES 8
+
+// A member's execution estimate rises to a longer call at once and falls
+// back by 1/2^n of the gap per shorter call, so one spike soon wears off
+#define SM_PROCESS_ESTIMATE_DECAY 2
+
+// Per-Task Execution Profiling
+#define SM_PROFILING true
+
+// Admission Control (EDF and Rate-Monotonic)
+#define SM_ADMISSION_REJECT true
+#ifndef SM_DISPATCH_OVERHEAD_US
+#define SM_DISPATCH_OVERHEAD_US 100
+#endif
+
+// Longest single idle request, so late registrations are noticed
+#define SM_IDLE_MAX_US 1000000UL
 
 #endif // __STATEMANAGER_CONFIGURATION_HPP__
\ No newline at end of file
@@ -0,0 +1,57 @@
+/**
+ ********************************************************************************
+ * @file    SM_Coroutine.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Stackless Coroutines for State Manager Processes
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __SM_COROUTINE_HPP__
+#define __SM_COROUTINE_HPP__
+
+namespace StateManager {
+
+// Resume point of a protothread-style coroutine. Locals do not survive a
+// yield, so anything needed after one must live outside the function.
+struct SM_CoroutineState {
+    unsigned int line;
+};
+
+// WAITING is a yield that made no progress, parked on an unmet condition
+enum class SM_CoroutineStatus {
+    CO_YIELDED,
+    CO_WAITING,
+    CO_FINISHED
+};
+
+typedef SM_CoroutineStatus (*SM_Coroutine_t)(SM_CoroutineState &state);
+
+} // end namespace StateManager
+
+#define SM_CO_BEGIN(state) \
+    switch ((state).line) { case 0:
+
+#define SM_CO_YIELD(state) \
+    do { \
+        (state).line = __LINE__; \
+        return ::StateManager::SM_CoroutineStatus::CO_YIELDED; \
+        case __LINE__:; \
+    } while (0)
+
+#define SM_CO_WAIT_UNTIL(state, condition) \
+    do { \
+        (state).line = __LINE__; \
+        case __LINE__: \
+        if (!(condition)) return ::StateManager::SM_CoroutineStatus::CO_WAITING; \
+    } while (0)
+
+#define SM_CO_END(state) \
+    } \
+    (state).line = 0; \
+    return ::StateManager::SM_CoroutineStatus::CO_FINISHED
+
+#endif // __SM_COROUTINE_HPP__
@@ -13,12 +13,42 @@
 #ifndef __STATEMANAGER_TYPES_HPP__
 #define __STATEMANAGER_TYPES_HPP__
 
+#include <stdint.h>
+
+// Period Helpers (microseconds)
+#define SM_US(us) ((::StateManager::SM_Time)(us))
+#define SM_MS(ms) ((::StateManager::SM_Time)(ms) * 1000UL)
+#define SM_S(s) ((::StateManager::SM_Time)(s) * 1000000UL)
+#define SM_HZ(hz) ((::StateManager::SM_Time)(1000000UL / (hz)))
+
 namespace StateManager {
 
+class Process;
+
 typedef void (*SM_Function_t)();
 
-using SM_Time = unsigned long;
-using SM_WeightedPriority = unsigned long; 
+// Microseconds, wrapping every 2^32 us (71.6 min) on every platform
+using SM_Time = uint32_t;
+using SM_TimeDelta = int32_t;
+using SM_WeightedPriority = uint32_t;
+using SM_TaskIndex = unsigned int;
+using SM_Utilization = unsigned long;
+using SM_Event = unsigned char;
+
+typedef void (*SM_IdleHook_t)(SM_Time idle_us);
+
+const SM_TaskIndex SM_INVALID_TASK = (SM_TaskIndex)-1;
+const SM_Utilization SM_UTILIZATION_FULL = 1000000UL;
+const SM_WeightedPriority SM_WEIGHTED_PRIORITY_MAX = UINT32_MAX;
+
+// Signed distance from b to a; exact while the two are within 2^31 us (35.8 min)
+inline SM_TimeDelta SM_TimeDiff(SM_Time a, SM_Time b) {
+    return (SM_TimeDelta)(a - b);
+}
+
+inline bool SM_TimeBefore(SM_Time a, SM_Time b) {
+    return SM_TimeDiff(a, b) < 0;
+}
 
 enum class SM_Priority {
     PRIORITY_LOWEST = 1,
@@ -28,6 +58,70 @@ enum class SM_Priority {
     PRIORITY_HIGHEST
 };
 
+enum class SM_Scheduler {
+    SCHEDULER_WEIGHTED_SCAN,
+    SCHEDULER_DEADLINE_HEAP,
+    SCHEDULER_EDF,
+    SCHEDULER_RATE_MONOTONIC
+};
+
+enum class SM_TaskType {
+    TASK_FUNCTION,
+    TASK_PROCESS
+};
+
+// Immutable task definition, intended for const (flash-resident) task tables
+struct SM_TaskDescriptor {
+    const char *name;
+    SM_TaskType type;
+    union {
+        SM_Function_t function;
+        Process *process;
+    };
+    SM_Time period_us;
+    SM_Priority priority;
+    SM_Time wcet_us;
+
+    constexpr SM_TaskDescriptor()
+        : name(nullptr), type(SM_TaskType::TASK_FUNCTION), function(nullptr),
+          period_us(0), priority(SM_Priority::PRIORITY_MEDIUM), wcet_us(0) {}
+
+    constexpr SM_TaskDescriptor(const char *name, 
+                                SM_Function_t function, 
+                                SM_Time period_us, 
+                                SM_Priority priority = SM_Priority::PRIORITY_MEDIUM,
+                                SM_Time wcet_us = 0)
+        : name(name), type(SM_TaskType::TASK_FUNCTION), function(function),
+          period_us(period_us), priority(priority), wcet_us(wcet_us) {}
+
+    constexpr SM_TaskDescriptor(const char *name, 
+                                Process *process, 
+                                SM_Time period_us, 
+                                SM_Priority priority = SM_Priority::PRIORITY_MEDIUM,
+                                SM_Time wcet_us = 0)
+        : name(name), type(SM_TaskType::TASK_PROCESS), process(process),
+          period_us(period_us), priority(priority), wcet_us(wcet_us) {}
+};
+
+struct SM_TaskStats {
+    unsigned long calls;
+    unsigned long events;
+    unsigned long overruns;
+    SM_Time exec_min_us;
+    SM_Time exec_max_us;
+    unsigned long long exec_total_us;
+    SM_Time jitter_max_us;
+    unsigned long long jitter_total_us;
+    SM_Time last_start_us;
+};
+
+struct SM_TaskReport {
+    const char *name;
+    SM_Priority priority;
+    SM_Time period_us;
+    SM_TaskStats stats;
+};
+
 } // end namespace StateManager
 
 #endif // __STATEMANAGER_TYPES_HPP__
\ No newline at end of file
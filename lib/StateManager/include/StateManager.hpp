@@ -13,10 +13,11 @@
 #ifndef __STATE_MANAGER_HPP__
 #define __STATE_MANAGER_HPP__
 
-#include <List.tpp>
+#include <PriorityQueue.tpp>
 
 #include "SM_Configuration.hpp"
 #include "SM_Types.hpp"
+#include "StateManager_Executor.hpp"
 #include "StateManager_Process.hpp"
 
 #define S_TO_MS(s) (s * 1000)
@@ -25,51 +26,134 @@ namespace StateManager {
     
 class StateManager {
 
-    struct SMFunction {
-        const char *name;
-        SM_Function_t function;
-        SM_Priority priority;
-        SM_Time period_ms;
-        SM_Time last_call;
-    };
-    struct SMProcess {
-        const char *name;
-        Process* process;
-        SM_Priority priority;
-        SM_Time period_ms;
+    // Mutable run-time state; the task definition itself stays in its descriptor
+    struct SMTask {
+        const SM_TaskDescriptor *descriptor;
+        SM_TaskIndex index;
         SM_Time last_call;
+        SM_Time release;
+#if SM_PROFILING
+        SM_TaskStats stats;
+#endif
+#ifndef ARDUINO
+        bool in_flight;
+        int affinity;
+#endif
     };
 
-    using FunctionList = DataStructures::List<SMFunction>;
-    using ProcessList = DataStructures::List<SMProcess>;
-    using ListSize = DataStructures::ListSize_t;
+    struct ReleasePrecedes {
+        inline bool operator()(SMTask *const &a, SMTask *const &b) const {
+            return SM_TimeBefore(a->release, b->release);
+        }
+    };
 
 public:
-    StateManager();
+    StateManager(SM_Scheduler scheduler = SM_Scheduler::SCHEDULER_DEADLINE_HEAP);
+
+    // Builds the schedule from a static task table without copying descriptors
+    template<SM_TaskIndex N>
+    StateManager(const SM_TaskDescriptor (&table)[N], 
+                 SM_Scheduler scheduler = SM_Scheduler::SCHEDULER_DEADLINE_HEAP)
+        : StateManager(scheduler) {
+        static_assert(N <= SM_MAX_TASKS, "Task table exceeds SM_MAX_TASKS");
+        for (SM_TaskIndex i = 0; i < N; i++) AddTask(table[i]);
+    }
+
     ~StateManager();
 
-    void Register(const char *name, 
-                  SM_Function_t function, 
-                  SM_Time period_ms, 
-                  SM_Priority priority = SM_Priority::PRIORITY_MEDIUM);
+    SM_TaskIndex Register(const char *name, 
+                          SM_Function_t function, 
+                          SM_Time period_us, 
+                          SM_Priority priority = SM_Priority::PRIORITY_MEDIUM,
+                          SM_Time wcet_us = 0);
+
+    SM_TaskIndex Register(const char *name, 
+                          Process* process, 
+                          SM_Time period_us, 
+                          SM_Priority priority = SM_Priority::PRIORITY_MEDIUM,
+                          SM_Time wcet_us = 0);
 
-    void Register(const char *name, 
-                  Process* process, 
-                  SM_Time period_ms, 
-                  SM_Priority priority = SM_Priority::PRIORITY_MEDIUM);
+    bool Run();
 
-    void Run();
+    // Signal() is safe to call from an ISR; bound tasks run ahead of periodic work
+    bool Bind(SM_Event event, SM_TaskIndex index);
+    void Signal(SM_Event event);
+
+    SM_Time TimeUntilNextDue();
+    void SetIdleHook(SM_IdleHook_t hook);
+    SM_Utilization IdleFraction();
+
+    bool CheckSchedulability();
+    SM_Utilization Utilization();
+
+#ifndef ARDUINO
+    // Released tasks run on the executor's workers; WEIGHTED_SCAN stays serial.
+    // A pin to a worker the executor does not have is refused.
+    bool SetExecutor(Executor *executor);
+    bool Pin(SM_TaskIndex index, unsigned int worker);
+#endif
+
+    SM_TaskIndex TaskCount();
+    bool GetTaskReport(SM_TaskIndex index, SM_TaskReport &report);
+    void ResetTaskStats();
 
 private:
 
-    FunctionList functions;
-    ProcessList processes;
+    const SM_Scheduler scheduler;
+
+    SMTask tasks[SM_MAX_TASKS];
+    SM_TaskIndex task_count;
+
+    // Descriptors for Tasks Registered at Run Time
+    SM_TaskDescriptor registered[SM_MAX_REGISTERED_TASKS];
+    SM_TaskIndex registered_count;
+
+    // Release Heap (min-heap on next release time) and Released Tasks
+    DataStructures::PriorityQueue<SMTask*, ReleasePrecedes, SM_MAX_TASKS> release_heap;
+    SMTask *ready_tasks[SM_MAX_TASKS];
+    SM_TaskIndex ready_task_count;
+
+    // Pending Events and their Bound Tasks
+    volatile bool events_pending;
+    volatile unsigned char event_flags[SM_MAX_EVENTS];
+    SM_TaskIndex event_tasks[SM_MAX_EVENTS];
+
+    // Idle Accounting since the last statistics reset
+    SM_IdleHook_t idle_hook;
+    unsigned long long busy_us;
+    unsigned long window_start_ms;
+
+#ifndef ARDUINO
+    Executor *executor;
+
+    bool RunParallel();
+    static SM_Time ExecuteJob(void *owner, void *context);
+#endif
+
+    SM_TaskIndex Register(const SM_TaskDescriptor &descriptor);
+    SM_TaskIndex AddTask(const SM_TaskDescriptor &descriptor);
+
+    bool IsSchedulable(SM_TaskIndex count);
+    SM_Time WorstCaseExecution(const SMTask &task);
+
+    bool RunEvents();
+    bool RunWeightedScan();
+    bool RunDeadlineHeap();
+
+    bool IsReleased(const SMTask &task, SM_Time now);
+    SM_TaskIndex SelectReadyTask(SM_Time now);
+    void AdvanceRelease(SMTask &task);
+
+    SM_WeightedPriority DetermineWeightedPriority(SMTask &task, SM_Time now);
 
-    SM_WeightedPriority DetermineWeightedFunctionPriority(ListSize f_index);
-    SM_WeightedPriority DetermineWeightedProcessPriority(ListSize p_index);
+    void CallTask(SMTask &task, bool event = false);
+    SM_Time ExecuteTask(SMTask &task, bool event, SM_Time &start_us);
+    void CallFunction(SMTask &task);
+    void CallProcess(SMTask &task, bool event);
 
-    void CallFunction(ListSize f_index);
-    void CallProcess(ListSize p_index);
+#if SM_PROFILING
+    void RecordExecution(SMTask &task, SM_Time start_us, SM_Time end_us, bool event);
+#endif
 
 };
 
@@ -0,0 +1,91 @@
+/**
+ ********************************************************************************
+ * @file    StateManager_Executor.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Work-Stealing Thread Pool for Host Builds of the State Manager
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __STATEMANAGER_EXECUTOR_HPP__
+#define __STATEMANAGER_EXECUTOR_HPP__
+
+#ifndef ARDUINO
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "SM_Configuration.hpp"
+#include "SM_Types.hpp"
+
+namespace StateManager {
+
+const unsigned int SM_PRIORITY_LEVELS = (unsigned int)SM_Priority::PRIORITY_HIGHEST;
+
+// Jobs go to their home worker; idle workers steal unpinned jobs from the
+// others, highest priority first. Finished jobs are handed back through
+// Collect() so the submitting thread keeps sole ownership of the schedule.
+class Executor {
+
+    public:
+        struct Job {
+            void *owner;
+            void *context;
+            SM_Time (*run)(void *owner, void *context);
+            SM_Priority priority;
+            unsigned int worker;
+            bool pinned;
+            SM_Time exec_us;
+        };
+
+        Executor(unsigned int workers = 0);
+        ~Executor();
+
+        void Submit(const Job &job);
+        bool Collect(Job &job);
+
+        unsigned int Workers();
+        unsigned long long Steals();
+
+    private:
+        struct Worker {
+            Worker() : pinned_queued(0) {}
+
+            std::mutex mutex;
+            std::deque<Job> pinned[SM_PRIORITY_LEVELS];
+            std::deque<Job> shared[SM_PRIORITY_LEVELS];
+            std::atomic<unsigned int> pinned_queued;
+            std::thread thread;
+        };
+
+        std::vector<Worker*> workers;
+        std::atomic<bool> running;
+        std::atomic<unsigned long long> steals;
+
+        std::mutex sleep_mutex;
+        std::condition_variable work_available;
+        // A worker may run its own pinned jobs and any shared job, so it only
+        // wakes for those; pinned work for another worker leaves it asleep
+        std::atomic<unsigned int> shared_queued;
+
+        std::mutex completed_mutex;
+        std::deque<Job> completed;
+
+        void Work(unsigned int self);
+        bool Take(unsigned int self, Job &job);
+        bool Steal(unsigned int self, Job &job);
+
+};
+
+} // end namespace StateManager
+
+#endif // ARDUINO
+
+#endif // __STATEMANAGER_EXECUTOR_HPP__
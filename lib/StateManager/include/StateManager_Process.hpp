@@ -13,9 +13,8 @@
 #ifndef __STATEMANAGER_PROCESS_HPP__
 #define __STATEMANAGER_PROCESS_HPP__
 
-#include <List.tpp>
-
 #include "SM_Configuration.hpp"
+#include "SM_Coroutine.hpp"
 #include "SM_Types.hpp"
 
 namespace StateManager {
@@ -25,21 +24,35 @@ class Process {
     struct Function {
         const char *name;
         SM_Function_t function;
+        SM_Coroutine_t coroutine;
+        SM_CoroutineState state;
+        SM_Time period_us;
+        SM_Time next_due;
+        SM_Time exec_estimate_us;
+        bool advanced;
     };
 
-    using FunctionList = DataStructures::List<Function>;
-    using ListSize = DataStructures::ListSize_t;
-
     public:
-        Process();
+        // Without a budget each invocation runs one due member, round-robin;
+        // with one it runs due members in order while they are expected to fit
+        Process(SM_Time budget_us = 0);
         ~Process();
 
-        void Register(const char *name, SM_Function_t function);
+        bool Register(const char *name, SM_Function_t function, SM_Time period_us = 0);
+        bool Register(const char *name, SM_Coroutine_t coroutine, SM_Time period_us = 0);
         void Run();
+        void RunAll();
     
     private:
-        FunctionList functions;
-        ListSize index;
+        const SM_Time budget_us;
+
+        Function functions[SM_MAX_PROCESS_FUNCTIONS];
+        SM_TaskIndex function_count;
+        SM_TaskIndex index;
+
+        Function* Add(const char *name, SM_Time period_us);
+        bool IsDue(const Function &function, SM_Time now);
+        bool Call(Function &function, SM_Time now);
 
 };
 
@@ -12,7 +12,8 @@
 
 #include "StateManager.hpp"
 
-#include <List.tpp>
+#include <Logging.hpp>
+#include <Platform.hpp>
 
 #include "SM_Configuration.hpp"
 #include "SM_Types.hpp"
@@ -20,138 +21,616 @@
 
 namespace StateManager {
 
-StateManager::StateManager() {}
+namespace {
+
+inline SM_Time Now() {
+    return (SM_Time)Platform::Clock::Micros();
+}
+
+template<typename Task>
+inline SM_Time Deadline(const Task *task) {
+    return task->release + task->descriptor->period_us;
+}
+
+template<typename Task>
+inline bool RateMonotonicPrecedes(const Task *a, const Task *b) {
+    SM_Time a_period_us = a->descriptor->period_us;
+    SM_Time b_period_us = b->descriptor->period_us;
+    return a_period_us < b_period_us || (a_period_us == b_period_us && a->index < b->index);
+}
+
+inline bool IsPeriodic(SM_Scheduler scheduler) {
+    return scheduler == SM_Scheduler::SCHEDULER_EDF || scheduler == SM_Scheduler::SCHEDULER_RATE_MONOTONIC;
+}
+
+// Saturates instead of wrapping for tasks that have been overdue for a long time
+inline SM_WeightedPriority SaturatingMultiply(SM_WeightedPriority a, SM_WeightedPriority b) {
+    if (a != 0 && b > SM_WEIGHTED_PRIORITY_MAX / a) return SM_WEIGHTED_PRIORITY_MAX;
+    return a * b;
+}
+
+inline void ClearStats(SM_TaskStats &stats) {
+    stats.calls = 0;
+    stats.events = 0;
+    stats.overruns = 0;
+    stats.exec_min_us = (SM_Time)-1;
+    stats.exec_max_us = 0;
+    stats.exec_total_us = 0;
+    stats.jitter_max_us = 0;
+    stats.jitter_total_us = 0;
+    stats.last_start_us = 0;
+}
+
+} // end namespace
+
+StateManager::StateManager(SM_Scheduler scheduler)
+    : scheduler(scheduler),
+      task_count(0),
+      registered_count(0),
+      ready_task_count(0),
+      events_pending(false),
+      idle_hook(NULL),
+      busy_us(0),
+      window_start_ms(Platform::Clock::Millis())
+#ifndef ARDUINO
+      , executor(NULL)
+#endif
+      {
+    for (SM_Event event = 0; event < SM_MAX_EVENTS; event++) {
+        event_flags[event] = 0;
+        event_tasks[event] = SM_INVALID_TASK;
+    }
+}
+
 StateManager::~StateManager() {}
 
-void StateManager::Register(const char *name, 
-                            SM_Function_t function, 
-                            SM_Time period_ms, 
-                            SM_Priority priority) {
-    SMFunction new_function = {
-        .name = name,
-        .function = function,
-        .priority = priority,
-        .period_ms = period_ms,
-        .last_call = 0
-    };
-
-    functions.push_back(new_function);
-
-    SM_DEBUG.print("Registered Function: ");
-    SM_DEBUG.println(name);
-    SM_DEBUG.print("\tPeriod: ");
-    SM_DEBUG.print(period_ms);
-    SM_DEBUG.println("ms");
-    SM_DEBUG.print("\tPriority: ");
-    SM_DEBUG.println((int)priority);
-}
-
-void StateManager::Register(const char *name, 
-                            Process* process, 
-                            SM_Time period_ms, 
-                            SM_Priority priority) {
-    SMProcess new_process = {
-        .name = name,
-        .process = process,
-        .priority = priority,
-        .period_ms = period_ms,
-        .last_call = 0
-    };
-
-    processes.push_back(new_process);
-
-    SM_DEBUG.print("Registered Process: ");
-    SM_DEBUG.println(name);
-    SM_DEBUG.print("\tPeriod: ");
-    SM_DEBUG.print(period_ms);
-    SM_DEBUG.println("ms");
-    SM_DEBUG.print("\tPriority: ");
-    SM_DEBUG.println((int)priority);
-}
-
-void StateManager::Run() {
-    if (functions.size() == 0 && processes.size() == 0) return;
-
-    SM_DEBUG.print("Iterating through ");
-    SM_DEBUG.print(functions.size());
-    SM_DEBUG.println(" functions...");
-
-    SM_WeightedPriority max_function_priority = 0;
-    ListSize max_function_priority_index = 0;
-    for (ListSize i = 0; i < functions.size(); i++) {
-        SM_WeightedPriority priority = DetermineWeightedFunctionPriority(i);
-        if (priority > max_function_priority) {
-            max_function_priority = priority;
-            max_function_priority_index = i;
+SM_TaskIndex StateManager::Register(const char *name, 
+                                    SM_Function_t function, 
+                                    SM_Time period_us, 
+                                    SM_Priority priority,
+                                    SM_Time wcet_us) {
+    return Register(SM_TaskDescriptor(name, function, period_us, priority, wcet_us));
+}
+
+SM_TaskIndex StateManager::Register(const char *name, 
+                                    Process* process, 
+                                    SM_Time period_us, 
+                                    SM_Priority priority,
+                                    SM_Time wcet_us) {
+    return Register(SM_TaskDescriptor(name, process, period_us, priority, wcet_us));
+}
+
+SM_TaskIndex StateManager::Register(const SM_TaskDescriptor &descriptor) {
+    if (registered_count >= SM_MAX_REGISTERED_TASKS) {
+        LOG_ERROR(SM_TASK_TABLE_FULL, task_count);
+        return SM_INVALID_TASK;
+    }
+
+    registered[registered_count] = descriptor;
+    SM_TaskIndex index = AddTask(registered[registered_count]);
+    if (index != SM_INVALID_TASK) registered_count++;
+    return index;
+}
+
+SM_TaskIndex StateManager::AddTask(const SM_TaskDescriptor &descriptor) {
+    if (task_count >= SM_MAX_TASKS) {
+        LOG_ERROR(SM_TASK_TABLE_FULL, task_count);
+        return SM_INVALID_TASK;
+    }
+
+    // Stage the candidate in the next free slot so admission sees a contiguous set
+    SMTask &task = tasks[task_count];
+    task.descriptor = &descriptor;
+    task.index = task_count;
+    task.last_call = Now();
+    task.release = IsPeriodic(scheduler) ? task.last_call : task.last_call + descriptor.period_us;
+#if SM_PROFILING
+    ClearStats(task.stats);
+#endif
+#ifndef ARDUINO
+    task.in_flight = false;
+    task.affinity = -1;
+#endif
+
+    if (!IsSchedulable(task_count + 1)) {
+        if (SM_ADMISSION_REJECT && IsPeriodic(scheduler)) {
+            LOG_ERROR(SM_ADMISSION_REJECTED, task.index);
+            return SM_INVALID_TASK;
         }
+        LOG_WARNING(SM_ADMISSION_OVERLOAD, task.index);
     }
 
-    SM_DEBUG.print("Iterating through ");
-    SM_DEBUG.print(processes.size());
-    SM_DEBUG.println(" processes...");
-        
-    SM_WeightedPriority max_process_priority = 0;
-    ListSize max_process_priority_index = 0;
-    for (ListSize i = 0; i < processes.size(); i++) {
-        SM_WeightedPriority priority = DetermineWeightedProcessPriority(i);
-        if (priority > max_process_priority) {
-            max_process_priority = priority;
-            max_process_priority_index = i;
+    task_count++;
+
+    if (scheduler != SM_Scheduler::SCHEDULER_WEIGHTED_SCAN) release_heap.push(&task);
+
+    switch (descriptor.type) {
+        case SM_TaskType::TASK_FUNCTION:
+            LOG_INFO(SM_REGISTERED_FUNCTION, task.index, descriptor.period_us, (int)descriptor.priority);
+            break;
+        case SM_TaskType::TASK_PROCESS:
+            LOG_INFO(SM_REGISTERED_PROCESS, task.index, descriptor.period_us, (int)descriptor.priority);
+            break;
+    }
+
+    return task.index;
+}
+
+bool StateManager::Run() {
+    if (task_count == 0) return false;
+
+    bool dispatched = RunEvents();
+    if (!dispatched) switch (scheduler) {
+        case SM_Scheduler::SCHEDULER_WEIGHTED_SCAN:
+            dispatched = RunWeightedScan();
+            break;
+        case SM_Scheduler::SCHEDULER_DEADLINE_HEAP:
+        case SM_Scheduler::SCHEDULER_EDF:
+        case SM_Scheduler::SCHEDULER_RATE_MONOTONIC:
+            dispatched = RunDeadlineHeap();
+            break;
+    }
+
+    if (!dispatched && idle_hook != NULL) {
+        SM_Time idle_us = TimeUntilNextDue();
+        if (idle_us > 0) idle_hook((idle_us > SM_IDLE_MAX_US) ? SM_IDLE_MAX_US : idle_us);
+    }
+
+    return dispatched;
+}
+
+bool StateManager::Bind(SM_Event event, SM_TaskIndex index) {
+    if (event >= SM_MAX_EVENTS || index >= task_count) {
+        LOG_ERROR(SM_INVALID_EVENT, event, index);
+        return false;
+    }
+
+    event_tasks[event] = index;
+    LOG_INFO(SM_EVENT_BOUND, event, index);
+    return true;
+}
+
+void StateManager::Signal(SM_Event event) {
+    if (event >= SM_MAX_EVENTS) return;
+
+    // Single-byte stores, so no critical section is needed on AVR
+    event_flags[event] = 1;
+    events_pending = true;
+    Platform::Wake();
+}
+
+bool StateManager::RunEvents() {
+    if (!events_pending) return false;
+    events_pending = false;
+
+    // Lowest event ID first; anything left over re-arms the pending flag
+    SM_Event event = 0;
+    for (; event < SM_MAX_EVENTS; event++) {
+        if (event_flags[event] == 0) continue;
+        event_flags[event] = 0;
+        if (event_tasks[event] != SM_INVALID_TASK) break;
+    }
+    for (SM_Event remaining = event + 1; remaining < SM_MAX_EVENTS; remaining++) {
+        if (event_flags[remaining] != 0) events_pending = true;
+    }
+
+    if (event >= SM_MAX_EVENTS) return false;
+
+#ifndef ARDUINO
+    // Never run a task twice at once; retry once its worker hands it back
+    if (tasks[event_tasks[event]].in_flight) {
+        event_flags[event] = 1;
+        events_pending = true;
+        return false;
+    }
+#endif
+
+    LOG_DEBUG(SM_EVENT_DISPATCH, event, event_tasks[event]);
+    CallTask(tasks[event_tasks[event]], true);
+    return true;
+}
+
+SM_Time StateManager::TimeUntilNextDue() {
+    if (events_pending) return 0;
+
+    SM_Time now = Now();
+
+    if (scheduler == SM_Scheduler::SCHEDULER_WEIGHTED_SCAN) {
+        // Weighted priority becomes nonzero once a task is more than one period late
+        SM_Time next_due_us = (SM_Time)-1;
+        for (SM_TaskIndex i = 0; i < task_count; i++) {
+            SM_Time due = tasks[i].last_call + tasks[i].descriptor->period_us + 1;
+            if (!SM_TimeBefore(now, due)) return 0;
+            if (due - now < next_due_us) next_due_us = due - now;
         }
+        return next_due_us;
     }
 
-    if (max_function_priority == 0 && max_process_priority == 0) return;
-        
-    if (max_function_priority > max_process_priority) {
-        CallFunction(max_function_priority_index);
+    if (ready_task_count > 0) return 0;
+    if (release_heap.empty()) return (SM_Time)-1;
+
+    SM_Time due = release_heap.top()->release + (IsPeriodic(scheduler) ? 0 : 1);
+    return SM_TimeBefore(now, due) ? due - now : 0;
+}
+
+void StateManager::SetIdleHook(SM_IdleHook_t hook) {
+    idle_hook = hook;
+}
+
+SM_Utilization StateManager::IdleFraction() {
+    unsigned long long window_us = (unsigned long long)(Platform::Clock::Millis() - window_start_ms) * 1000;
+#ifndef ARDUINO
+    // Parallel busy time is summed over the workers, so each one adds a window
+    if (executor != NULL && scheduler != SM_Scheduler::SCHEDULER_WEIGHTED_SCAN) window_us *= executor->Workers();
+#endif
+    if (window_us == 0 || busy_us >= window_us) return 0;
+    return SM_UTILIZATION_FULL - (busy_us * SM_UTILIZATION_FULL) / window_us;
+}
+
+bool StateManager::CheckSchedulability() {
+    if (task_count == 0) return true;
+    return IsSchedulable(task_count);
+}
+
+SM_Utilization StateManager::Utilization() {
+    SM_Utilization utilization = 0;
+    for (SM_TaskIndex i = 0; i < task_count; i++) {
+        SM_Time period_us = tasks[i].descriptor->period_us;
+        if (period_us == 0) continue;
+        utilization += ((unsigned long long)WorstCaseExecution(tasks[i]) * SM_UTILIZATION_FULL) / period_us;
     }
-    else {
-        CallProcess(max_process_priority_index);
+    return utilization;
+}
+
+SM_TaskIndex StateManager::TaskCount() {
+    return task_count;
+}
+
+bool StateManager::GetTaskReport(SM_TaskIndex index, SM_TaskReport &report) {
+    if (index >= task_count) return false;
+
+    SMTask &task = tasks[index];
+    report.name = task.descriptor->name;
+    report.priority = task.descriptor->priority;
+    report.period_us = task.descriptor->period_us;
+#if SM_PROFILING
+    report.stats = task.stats;
+#else
+    ClearStats(report.stats);
+#endif
+    return true;
+}
+
+void StateManager::ResetTaskStats() {
+    busy_us = 0;
+    window_start_ms = Platform::Clock::Millis();
+#if SM_PROFILING
+    for (SM_TaskIndex i = 0; i < task_count; i++) {
+        ClearStats(tasks[i].stats);
     }
+#endif
 }
 
-SM_WeightedPriority StateManager::DetermineWeightedFunctionPriority(ListSize f_index) {
-    SMFunction &function = functions[f_index];
-    SM_Time delay_time = millis() - function.last_call;
-    SM_Time delta_time = (delay_time > function.period_ms) ? delay_time - function.period_ms : 0;
-    SM_WeightedPriority weighted_priority = (SM_WeightedPriority)function.priority * delta_time;
+bool StateManager::IsSchedulable(SM_TaskIndex count) {
+    // Necessary for every policy: the task set fits on one processor
+    SM_Utilization utilization = 0;
+    SM_Time max_wcet_us = 0;
+    SM_Time min_period_us = (SM_Time)-1;
+    for (SM_TaskIndex i = 0; i < count; i++) {
+        const SMTask &task = tasks[i];
+        if (task.descriptor->period_us == 0) {
+            if (!IsPeriodic(scheduler)) continue;
+            LOG_WARNING(SM_INVALID_PERIOD, task.index);
+            return false;
+        }
+        SM_Time wcet_us = WorstCaseExecution(task);
+        SM_Time period_us = task.descriptor->period_us;
+        utilization += ((unsigned long long)wcet_us * SM_UTILIZATION_FULL) / period_us;
+        if (wcet_us > max_wcet_us) max_wcet_us = wcet_us;
+        if (period_us < min_period_us) min_period_us = period_us;
+    }
+    if (utilization > SM_UTILIZATION_FULL) {
+        LOG_WARNING(SM_UTILIZATION_EXCEEDED, utilization);
+        return false;
+    }
+
+    switch (scheduler) {
+        case SM_Scheduler::SCHEDULER_EDF: {
+            // Non-preemptive EDF: density test with blocking by the longest job
+            SM_Utilization blocking = ((unsigned long long)max_wcet_us * SM_UTILIZATION_FULL) / min_period_us;
+            if (utilization + blocking > SM_UTILIZATION_FULL) {
+                LOG_WARNING(SM_UTILIZATION_EXCEEDED, utilization + blocking);
+                return false;
+            }
+            return true;
+        }
+        case SM_Scheduler::SCHEDULER_RATE_MONOTONIC:
+            // Non-preemptive fixed-priority response time analysis (Davis et al., 2007)
+            for (SM_TaskIndex i = 0; i < count; i++) {
+                const SMTask *task = &tasks[i];
+                SM_Time wcet_us = WorstCaseExecution(*task);
+                SM_Time period_us = task->descriptor->period_us;
 
-    SM_DEBUG.print(function.name);
-    SM_DEBUG.print(": ");
-    SM_DEBUG.print(delta_time);
-    SM_DEBUG.print("ms, ");
-    SM_DEBUG.println(weighted_priority);
+                SM_Time blocking_us = wcet_us;
+                for (SM_TaskIndex j = 0; j < count; j++) {
+                    if (!RateMonotonicPrecedes(task, &tasks[j]) || i == j) continue;
+                    SM_Time lower_wcet_us = WorstCaseExecution(tasks[j]);
+                    if (lower_wcet_us > blocking_us) blocking_us = lower_wcet_us;
+                }
 
-    return weighted_priority;
+                SM_Time queuing_us = blocking_us;
+                while (queuing_us + wcet_us <= period_us) {
+                    SM_Time next_queuing_us = blocking_us;
+                    for (SM_TaskIndex j = 0; j < count; j++) {
+                        if (!RateMonotonicPrecedes(&tasks[j], task)) continue;
+                        next_queuing_us += (queuing_us / tasks[j].descriptor->period_us + 1) * WorstCaseExecution(tasks[j]);
+                    }
+                    if (next_queuing_us == queuing_us) break;
+                    queuing_us = next_queuing_us;
+                }
+
+                SM_Time response_us = queuing_us + wcet_us;
+                if (response_us > period_us) {
+                    LOG_WARNING(SM_RESPONSE_TIME_EXCEEDED, task->index, response_us, period_us);
+                    return false;
+                }
+            }
+            return true;
+        default:
+            return true;
+    }
+}
+
+SM_Time StateManager::WorstCaseExecution(const SMTask &task) {
+    SM_Time wcet_us = task.descriptor->wcet_us;
+#if SM_PROFILING
+    if (task.stats.calls > 0 && task.stats.exec_max_us > wcet_us) wcet_us = task.stats.exec_max_us;
+#endif
+    return wcet_us + SM_DISPATCH_OVERHEAD_US;
+}
+
+bool StateManager::RunWeightedScan() {
+    LOG_TRACE(SM_SCAN, task_count);
+
+    SM_Time now = Now();
+    SM_WeightedPriority max_priority = 0;
+    SM_TaskIndex max_priority_index = 0;
+    for (SM_TaskIndex i = 0; i < task_count; i++) {
+        SM_WeightedPriority priority = DetermineWeightedPriority(tasks[i], now);
+        if (priority > max_priority) {
+            max_priority = priority;
+            max_priority_index = i;
+        }
+    }
+
+    if (max_priority == 0) return false;
+
+    CallTask(tasks[max_priority_index]);
+    return true;
+}
+
+bool StateManager::RunDeadlineHeap() {
+#ifndef ARDUINO
+    if (executor != NULL) return RunParallel();
+#endif
+
+    SM_Time now = Now();
+
+    // Move Released Tasks out of the Heap
+    while (!release_heap.empty() && IsReleased(*release_heap.top(), now)) {
+        ready_tasks[ready_task_count++] = release_heap.pop();
+    }
+
+    if (ready_task_count == 0) return false;
+
+    SM_TaskIndex selected = SelectReadyTask(now);
+    SMTask *task = ready_tasks[selected];
+    ready_tasks[selected] = ready_tasks[--ready_task_count];
+
+    CallTask(*task);
+    AdvanceRelease(*task);
+    release_heap.push(task);
+    return true;
 }
 
-SM_WeightedPriority StateManager::DetermineWeightedProcessPriority(ListSize p_index) {
-    SMProcess &process = processes[p_index];
-    SM_Time delay_time = millis() - process.last_call;
-    SM_Time delta_time = (delay_time > process.period_ms) ? delay_time - process.period_ms : 0;
-    SM_WeightedPriority weighted_priority = (SM_WeightedPriority)process.priority * delta_time;
-        
-    SM_DEBUG.print(process.name);
-    SM_DEBUG.print(": ");
-    SM_DEBUG.print(delta_time);
-    SM_DEBUG.print("ms, ");
-    SM_DEBUG.println(weighted_priority);
-        
+bool StateManager::IsReleased(const SMTask &task, SM_Time now) {
+    if (IsPeriodic(scheduler)) return !SM_TimeBefore(now, task.release);
+    return SM_TimeBefore(task.release, now);
+}
+
+SM_TaskIndex StateManager::SelectReadyTask(SM_Time now) {
+    SM_TaskIndex selected = 0;
+
+    switch (scheduler) {
+        case SM_Scheduler::SCHEDULER_EDF:
+            for (SM_TaskIndex i = 1; i < ready_task_count; i++) {
+                SM_Time deadline = Deadline(ready_tasks[i]);
+                SM_Time selected_deadline = Deadline(ready_tasks[selected]);
+                if (SM_TimeBefore(deadline, selected_deadline) || 
+                    (deadline == selected_deadline && ready_tasks[i]->index < ready_tasks[selected]->index)) {
+                    selected = i;
+                }
+            }
+            break;
+        case SM_Scheduler::SCHEDULER_RATE_MONOTONIC:
+            for (SM_TaskIndex i = 1; i < ready_task_count; i++) {
+                if (RateMonotonicPrecedes(ready_tasks[i], ready_tasks[selected])) selected = i;
+            }
+            break;
+        default: {
+            // Weighted Priority Tie-Break among Overdue Tasks
+            SM_WeightedPriority max_priority = 0;
+            for (SM_TaskIndex i = 0; i < ready_task_count; i++) {
+                SM_WeightedPriority priority = DetermineWeightedPriority(*ready_tasks[i], now);
+                if (priority > max_priority) {
+                    max_priority = priority;
+                    selected = i;
+                }
+            }
+            break;
+        }
+    }
+
+    return selected;
+}
+
+void StateManager::AdvanceRelease(SMTask &task) {
+    SM_Time period_us = task.descriptor->period_us;
+    if (!IsPeriodic(scheduler)) {
+        task.release = task.last_call + period_us;
+        return;
+    }
+
+    task.release += period_us;
+
+    // Drop releases missed under overload instead of running them back-to-back
+    SM_Time now = Now();
+    if (period_us > 0 && !SM_TimeBefore(now, task.release + period_us)) {
+        SM_Time skipped = (SM_Time)SM_TimeDiff(now, task.release) / period_us;
+        task.release += skipped * period_us;
+        LOG_DEBUG(SM_RELEASES_SKIPPED, task.index, skipped);
+    }
+}
+
+SM_WeightedPriority StateManager::DetermineWeightedPriority(SMTask &task, SM_Time now) {
+    SM_TimeDelta delay_time = SM_TimeDiff(now, task.last_call);
+    SM_Time period_us = task.descriptor->period_us;
+    SM_Time delta_time = (delay_time > 0 && (SM_Time)delay_time > period_us) ? (SM_Time)delay_time - period_us : 0;
+    SM_WeightedPriority weighted_priority = SaturatingMultiply((SM_WeightedPriority)task.descriptor->priority, delta_time);
+
+    LOG_TRACE(SM_WEIGHTED_PRIORITY, task.index, delta_time, weighted_priority);
+
     return weighted_priority;
 }
 
-void StateManager::CallFunction(ListSize f_index) {
-    SM_DEBUG.print("CALLING FUNCTION: ");
-    SM_DEBUG.println(functions[f_index].name);
-    functions[f_index].last_call = millis();
-    functions[f_index].function();
+void StateManager::CallTask(SMTask &task, bool event) {
+    SM_Time start_us;
+    SM_Time exec_us = ExecuteTask(task, event, start_us);
+    busy_us += exec_us;
+#if SM_PROFILING
+    RecordExecution(task, start_us, start_us + exec_us, event);
+#endif
+}
+
+// Stats are left to the caller so that only the dispatching thread writes them
+SM_Time StateManager::ExecuteTask(SMTask &task, bool event, SM_Time &start_us) {
+    start_us = Now();
+    if (!event) task.last_call = start_us;
+
+    switch (task.descriptor->type) {
+        case SM_TaskType::TASK_FUNCTION:
+            CallFunction(task);
+            break;
+        case SM_TaskType::TASK_PROCESS:
+            CallProcess(task, event);
+            break;
+    }
+
+    return Now() - start_us;
 }
 
-void StateManager::CallProcess(ListSize p_index) {
-    SM_DEBUG.print("CALLING PROCESS: ");
-    SM_DEBUG.println(processes[p_index].name);
-    processes[p_index].last_call = millis();
-    processes[p_index].process->Run();
+#ifndef ARDUINO
+// Pins made before attaching must name workers the executor has
+bool StateManager::SetExecutor(Executor *executor) {
+    if (executor != NULL) {
+        for (SM_TaskIndex i = 0; i < task_count; i++) {
+            if (tasks[i].affinity >= 0 && (unsigned int)tasks[i].affinity >= executor->Workers()) return false;
+        }
+    }
+    this->executor = executor;
+    return true;
+}
+
+bool StateManager::Pin(SM_TaskIndex index, unsigned int worker) {
+    if (index >= task_count) return false;
+    if (executor != NULL && worker >= executor->Workers()) return false;
+    tasks[index].affinity = worker;
+    return true;
+}
+
+bool StateManager::RunParallel() {
+    // Only this thread touches the release heap; workers report back here
+    Executor::Job job;
+    while (executor->Collect(job)) {
+        SMTask *task = (SMTask *)job.context;
+        busy_us += job.exec_us;
+#if SM_PROFILING
+        // Parallel jobs are never events, so last_call holds their start
+        RecordExecution(*task, task->last_call, task->last_call + job.exec_us, false);
+#endif
+        task->in_flight = false;
+        AdvanceRelease(*task);
+        release_heap.push(task);
+    }
+
+    SM_Time now = Now();
+    bool dispatched = false;
+    while (!release_heap.empty() && IsReleased(*release_heap.top(), now)) {
+        SMTask *task = release_heap.pop();
+        task->in_flight = true;
+
+        job.owner = this;
+        job.context = task;
+        job.run = ExecuteJob;
+        job.priority = task->descriptor->priority;
+        job.worker = (task->affinity < 0) ? task->index : task->affinity;
+        job.pinned = task->affinity >= 0;
+        executor->Submit(job);
+        dispatched = true;
+    }
+
+    return dispatched;
+}
+
+SM_Time StateManager::ExecuteJob(void *owner, void *context) {
+    SM_Time start_us;
+    return ((StateManager *)owner)->ExecuteTask(*(SMTask *)context, false, start_us);
+}
+#endif
+
+void StateManager::CallFunction(SMTask &task) {
+    LOG_DEBUG(SM_CALL_FUNCTION, task.index);
+    task.descriptor->function();
+}
+
+void StateManager::CallProcess(SMTask &task, bool event) {
+    LOG_DEBUG(SM_CALL_PROCESS, task.index);
+
+    // An event gives the whole process one pass instead of a single member
+    if (event) {
+        task.descriptor->process->RunAll();
+    }
+    else {
+        task.descriptor->process->Run();
+    }
+}
+
+#if SM_PROFILING
+void StateManager::RecordExecution(SMTask &task, SM_Time start_us, SM_Time end_us, bool event) {
+    SM_TaskStats &stats = task.stats;
+    SM_Time exec_us = end_us - start_us;
+    SM_Time period_us = task.descriptor->period_us;
+
+    if (exec_us < stats.exec_min_us) stats.exec_min_us = exec_us;
+    if (exec_us > stats.exec_max_us) stats.exec_max_us = exec_us;
+    stats.exec_total_us += exec_us;
+    stats.calls++;
+
+    // Event-triggered runs are off the periodic grid, so they skip jitter accounting
+    if (event) {
+        stats.events++;
+        return;
+    }
+
+    // Start Jitter and Deadline (release + period) Overruns
+    SM_TimeDelta lateness_us = (stats.calls - stats.events > 1) ? SM_TimeDiff(start_us, stats.last_start_us + period_us) : 0;
+    SM_Time jitter_us = (lateness_us < 0) ? -lateness_us : lateness_us;
+    if (jitter_us > stats.jitter_max_us) stats.jitter_max_us = jitter_us;
+    stats.jitter_total_us += jitter_us;
+    if ((int64_t)lateness_us + exec_us > period_us) stats.overruns++;
+
+    stats.last_start_us = start_us;
 }
+#endif
 
 } // end namespace StateManager
\ No newline at end of file
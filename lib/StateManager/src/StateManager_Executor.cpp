@@ -0,0 +1,169 @@
+/**
+ ********************************************************************************
+ * @file    StateManager_Executor.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Work-Stealing Thread Pool for Host Builds of the State Manager
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef ARDUINO
+
+#include "StateManager_Executor.hpp"
+
+#include <chrono>
+
+#include <Platform.hpp>
+
+#include "SM_Configuration.hpp"
+#include "SM_Types.hpp"
+
+namespace StateManager {
+
+namespace {
+
+inline unsigned int Level(SM_Priority priority) {
+    return SM_PRIORITY_LEVELS - (unsigned int)priority;
+}
+
+} // end namespace
+
+Executor::Executor(unsigned int workers) : running(true), steals(0), shared_queued(0) {
+    if (workers == 0) workers = std::thread::hardware_concurrency();
+    if (workers == 0) workers = 1;
+
+    for (unsigned int i = 0; i < workers; i++) {
+        this->workers.push_back(new Worker());
+    }
+    for (unsigned int i = 0; i < workers; i++) {
+        this->workers[i]->thread = std::thread(&Executor::Work, this, i);
+    }
+}
+
+Executor::~Executor() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        running = false;
+    }
+    work_available.notify_all();
+
+    for (Worker *worker : workers) {
+        worker->thread.join();
+        delete worker;
+    }
+}
+
+void Executor::Submit(const Job &job) {
+    Worker *worker = workers[job.worker % workers.size()];
+
+    // Counted before it is visible, so a worker's decrement never runs first
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        if (job.pinned) {
+            worker->pinned_queued++;
+        }
+        else {
+            shared_queued++;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (job.pinned) {
+            worker->pinned[Level(job.priority)].push_back(job);
+        }
+        else {
+            worker->shared[Level(job.priority)].push_back(job);
+        }
+    }
+    work_available.notify_all();
+}
+
+bool Executor::Collect(Job &job) {
+    std::lock_guard<std::mutex> lock(completed_mutex);
+    if (completed.empty()) return false;
+
+    job = completed.front();
+    completed.pop_front();
+    return true;
+}
+
+unsigned int Executor::Workers() {
+    return workers.size();
+}
+
+unsigned long long Executor::Steals() {
+    return steals;
+}
+
+void Executor::Work(unsigned int self) {
+    while (running) {
+        Job job;
+        if (Take(self, job) || Steal(self, job)) {
+            if (job.pinned) {
+                workers[self]->pinned_queued--;
+            }
+            else {
+                shared_queued--;
+            }
+            job.exec_us = job.run(job.owner, job.context);
+            {
+                std::lock_guard<std::mutex> lock(completed_mutex);
+                completed.push_back(job);
+            }
+            Platform::Wake();
+            continue;
+        }
+
+        // Sleep until there is work this worker may take
+        Worker *worker = workers[self];
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        work_available.wait_for(lock, std::chrono::milliseconds(1), [this, worker] {
+            return worker->pinned_queued > 0 || shared_queued > 0 || !running;
+        });
+    }
+}
+
+bool Executor::Take(unsigned int self, Job &job) {
+    Worker *worker = workers[self];
+    std::lock_guard<std::mutex> lock(worker->mutex);
+
+    for (unsigned int level = 0; level < SM_PRIORITY_LEVELS; level++) {
+        if (!worker->pinned[level].empty()) {
+            job = worker->pinned[level].front();
+            worker->pinned[level].pop_front();
+            return true;
+        }
+        if (!worker->shared[level].empty()) {
+            job = worker->shared[level].front();
+            worker->shared[level].pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Executor::Steal(unsigned int self, Job &job) {
+    // Highest priority across all victims first, taking the oldest job, the
+    // same one its owner would run next
+    for (unsigned int level = 0; level < SM_PRIORITY_LEVELS; level++) {
+        for (unsigned int offset = 1; offset < workers.size(); offset++) {
+            Worker *victim = workers[(self + offset) % workers.size()];
+            std::lock_guard<std::mutex> lock(victim->mutex);
+            if (victim->shared[level].empty()) continue;
+
+            job = victim->shared[level].front();
+            victim->shared[level].pop_front();
+            steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // end namespace StateManager
+
+#endif // ARDUINO
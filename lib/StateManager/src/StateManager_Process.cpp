@@ -12,32 +12,124 @@
 
 #include "StateManager_Process.hpp"
 
-#include <List.tpp>
+#include <Logging.hpp>
+#include <Platform.hpp>
 
 #include "SM_Configuration.hpp"
+#include "SM_Coroutine.hpp"
 #include "SM_Types.hpp"
 
 namespace StateManager {
-Process::Process() : index(0) {};
+
+namespace {
+
+inline SM_Time Now() {
+    return (SM_Time)Platform::Clock::Micros();
+}
+
+} // end namespace
+
+Process::Process(SM_Time budget_us) : budget_us(budget_us), function_count(0), index(0) {};
 Process::~Process() {};
 
-void Process::Register(const char *name, SM_Function_t function) { 
-    Function new_function = {
-        .name = name,
-        .function = function
-    };
-    functions.push_back(new_function);
+bool Process::Register(const char *name, SM_Function_t function, SM_Time period_us) { 
+    Function *new_function = Add(name, period_us);
+    if (new_function == NULL) return false;
+
+    new_function->function = function;
     
-    SM_DEBUG.print("Registered Function to Process: ");
-    SM_DEBUG.println(name);
+    LOG_INFO(SM_PROCESS_REGISTERED_FUNCTION, function_count - 1);
+    return true;
 };
 
-void Process::Run() {
-    if (functions.size() == 0) return;
+bool Process::Register(const char *name, SM_Coroutine_t coroutine, SM_Time period_us) { 
+    Function *new_coroutine = Add(name, period_us);
+    if (new_coroutine == NULL) return false;
+
+    new_coroutine->coroutine = coroutine;
     
-    functions[index].function();
-    index++;
-    index %= functions.size();
+    LOG_INFO(SM_PROCESS_REGISTERED_COROUTINE, function_count - 1);
+    return true;
+};
+
+Process::Function* Process::Add(const char *name, SM_Time period_us) {
+    if (function_count >= SM_MAX_PROCESS_FUNCTIONS) {
+        LOG_ERROR(SM_PROCESS_FULL, function_count);
+        return NULL;
+    }
+
+    Function &function = functions[function_count++];
+    function.name = name;
+    function.function = NULL;
+    function.coroutine = NULL;
+    function.state.line = 0;
+    function.period_us = period_us;
+    function.next_due = Now();
+    function.exec_estimate_us = 0;
+    function.advanced = false;
+    return &function;
+}
+
+void Process::Run() {
+    if (function_count == 0) return;
+
+    SM_Time start_us = Now();
+    SM_TaskIndex executed = 0;
+    for (unsigned int pass = 0; pass < SM_PROCESS_MAX_PASSES; pass++) {
+        bool advanced = false;
+        for (SM_TaskIndex n = 0; n < function_count; n++) {
+            Function &function = functions[index];
+            SM_Time now = Now();
+
+            // Later passes only revisit coroutines that advanced on the one before
+            bool eligible = pass == 0 || function.advanced;
+            function.advanced = false;
+            if (eligible && IsDue(function, now)) {
+                // Always make progress, then only start members expected to fit the budget;
+                // the member left over is first in line on the next invocation
+                if (executed > 0 && (budget_us == 0 || (SM_Time)SM_TimeDiff(now, start_us) + function.exec_estimate_us > budget_us)) return;
+                function.advanced = Call(function, now);
+                if (function.advanced) advanced = true;
+                executed++;
+            }
+            index = (index + 1) % function_count;
+        }
+
+        // Another pass only helps if a coroutine still has work in hand
+        if (!advanced || budget_us == 0) return;
+    }
+}
+
+void Process::RunAll() {
+    for (SM_TaskIndex i = 0; i < function_count; i++) {
+        Call(functions[i], Now());
+    }
+}
+
+bool Process::IsDue(const Function &function, SM_Time now) {
+    return function.period_us == 0 || !SM_TimeBefore(now, function.next_due);
+}
+
+bool Process::Call(Function &function, SM_Time now) {
+    if (function.period_us > 0) {
+        function.next_due += function.period_us;
+        if (SM_TimeBefore(function.next_due, now)) function.next_due = now + function.period_us;
+    }
+
+    // Coroutines pick up from their last yield when their turn comes around;
+    // one parked on a wait has not advanced
+    bool advanced = false;
+    if (function.coroutine != NULL) {
+        advanced = function.coroutine(function.state) == SM_CoroutineStatus::CO_YIELDED;
+    }
+    else {
+        function.function();
+    }
+
+    SM_Time exec_us = Now() - now;
+    if (exec_us > function.exec_estimate_us) function.exec_estimate_us = exec_us;
+    else function.exec_estimate_us -= (function.exec_estimate_us - exec_us) >> SM_PROCESS_ESTIMATE_DECAY;
+    return advanced;
 }
 
 } // end namespace StateManager
\ No newline at end of file
@@ -13,35 +13,117 @@
 #ifndef __TELECOMMUNICATION_HPP__
 #define __TELECOMMUNICATION_HPP__
 
-#include <Queue.tpp>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Platform_Memory.hpp>
+#include <SPSCQueue.tpp>
+#include <StaticQueue.tpp>
 
 #include "Telecommunication_Configuration.hpp"
+#include "Telecommunication_CRC.hpp"
 #include "Telecommunication_Literals.hpp"
 
 namespace Telecommunication {
 
+// Heap blocks held by outgoing strings
+extern Platform::Memory::Counter TX_MEMORY;
+
 class Telecommunication {
-    using MessageQueue = DataStructures::Queue<String>;
+    // Each queued frame remembers the mode it was built in, so a reply to
+    // SET_LINK still leaves in the mode the request arrived in
+    struct OutgoingFrame {
+        String string;
+        LinkMode mode;
+    };
+
+    struct FrameSlot {
+        char data[TELECOM_RECEIVE_BUFFER];
+        unsigned int length;
+        Checksum checksum;
+        LinkMode mode;
+    };
+
+    using MessageQueue = DataStructures::StaticQueue<OutgoingFrame, TELECOM_MESSAGE_QUEUE_LENGTH>;
 
     friend class TelecommunicationInterpreter;
     friend class TelecommunicationDelegator;
-    
+
+    static_assert(TELECOM_RECEIVE_SLOTS > 0 && TELECOM_RECEIVE_SLOTS <= 128 && (TELECOM_RECEIVE_SLOTS & (TELECOM_RECEIVE_SLOTS - 1)) == 0,
+                  "TELECOM_RECEIVE_SLOTS must be a power of two no larger than 128");
+
+    static const unsigned int DELIMITER_LENGTH = sizeof(TELECOM_MESSAGE_DELIMITER) - 1;
+
+    // The receive CRC trails the newest byte by the checksum trailer and the
+    // stored part of the delimiter, so it covers exactly the checked text
+    // once the frame is complete
+    static const unsigned int CHECKSUM_LAG = TELECOM_CHECKSUM_LENGTH + DELIMITER_LENGTH - 1;
+
+    enum class FrameState : uint8_t {
+        FILLING,
+        DISCARDING
+    };
+
     public:
+        struct FrameStatistics {
+            unsigned long frames;
+            unsigned long oversize;  // Frames longer than TELECOM_RECEIVE_BUFFER
+            unsigned long overruns;  // Frames that arrived while every slot was full
+            unsigned long resyncs;   // Delimiters that ended a discarded frame
+            unsigned long discarded; // Bytes thrown away while resynchronising
+        };
+
         Telecommunication();
         ~Telecommunication();
         
         void Receive(unsigned int count = 0);
         void Transmit(unsigned int count = 0);
+
+        // Framing for a single producer, which may be an RX interrupt. Each
+        // byte costs a constant amount of work; Feed returns true when the
+        // byte completed a frame.
+        bool Feed(uint8_t byte);
+        unsigned int Feed(const uint8_t *buffer, size_t length);
+
+        // Written by the producer; a reader racing an interrupt may see a torn count
+        inline const FrameStatistics& ReceiveStatistics() { return Statistics; }
+
+        // Frames that found the transmit queue full and had to wait for the oldest to be sent
+        inline unsigned long TransmitOverflows() { return TransmitQueue.overflows(); }
+
+        // Switches both directions. Frames already queued keep their mode and
+        // a frame being received finishes in the mode it started in.
+        inline void SetLinkMode(LinkMode mode) { Mode = mode; }
+        inline LinkMode GetLinkMode() { return Mode; }
     
     private:
-        TeleMessage GetReception();
+        bool GetReception(TeleMessage &message);
+        TeleMessage Parse(String string, Checksum expected_checksum);
         void SendTransmission(TeleMessage message);
-        
-        MessageQueue ReceiveQueue;
+        void SendBinaryTransmission(TeleMessage message);
+        void Enqueue(String string, LinkMode mode);
+        void SendDelimiter(LinkMode mode);
+
+        volatile LinkMode Mode;
+
         MessageQueue TransmitQueue;
-        
-        char ReceiveBuffer[TELECOM_RECEIVE_BUFFER];
-        unsigned int ReceiveBufferIndex;
+
+        // Frames are assembled in place in a ring of fixed slots and parsed
+        // where they lie. Slots are filled in order, so the producer owns
+        // ReceiveSlot until it is pushed onto ReceiveReady.
+        FrameSlot ReceiveFrames[TELECOM_RECEIVE_SLOTS];
+        CRC::Engine ReceiveCRC;
+        DataStructures::SPSCQueue<uint8_t, TELECOM_RECEIVE_SLOTS> ReceiveReady;
+        uint8_t ReceiveSlot;
+        unsigned int ReceiveIndex;
+        uint8_t DelimiterMatched;
+        FrameState State;
+        LinkMode FrameMode;
+        bool FrameText;
+        FrameStatistics Statistics;
+
+        // Key-values of the most recent reception, valid until the next one
+        KeyValue ReceivedPairs[TELECOM_MAX_KEY_VALUES];
 
 };
 
@@ -0,0 +1,49 @@
+/**
+ ********************************************************************************
+ * @file    Telecommunication_Binary.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Binary Framing for the Telecommunication Link
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __TELECOMMUNICATION_BINARY_HPP__
+#define __TELECOMMUNICATION_BINARY_HPP__
+
+#include <stdint.h>
+
+#include "Telecommunication_Types.hpp"
+
+namespace Telecommunication {
+
+namespace Binary {
+
+// A binary frame is COBS encoded and ends with a zero byte. Decoded it is
+//
+//     command, { keyword, value }..., CRC32
+//
+// with one-byte command and keyword IDs taken from the enums. Values are
+// little-endian: INTEGER as int32, DECIMAL as float32 and SET strings as a
+// one-byte index into the keyword's set. Free strings go out as a length byte
+// and their characters; like the ASCII parser, the decoder refuses them, and
+// tools/telecom_decoder.py decodes them on the ground. The CRC32 is the ASCII
+// one, over everything before it, sent little-endian.
+const uint8_t DELIMITER = 0x00;
+
+// Encodes message into at most capacity bytes, without the delimiter.
+// Returns the encoded length, or 0 when the frame does not fit.
+StringSize Encode(const TeleMessage &message, uint8_t *frame, StringSize capacity);
+
+// Decodes frame in place, writing at most capacity pairs
+TeleMessage Decode(uint8_t *frame, StringSize length, KeyValue *pairs, uint8_t capacity);
+
+StringSize CobsDecode(uint8_t *buffer, StringSize length);
+
+} // end namespace Binary
+
+} // end namespace Telecommunication
+
+#endif // __TELECOMMUNICATION_BINARY_HPP__
@@ -0,0 +1,56 @@
+/**
+ ********************************************************************************
+ * @file    Telecommunication_CRC.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Streaming CRC32 Engine
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#ifndef __TELECOMMUNICATION_CRC_HPP__
+#define __TELECOMMUNICATION_CRC_HPP__
+
+#include <stdint.h>
+
+#include "Telecommunication_Configuration.hpp"
+#include "Telecommunication_Types.hpp"
+
+namespace Telecommunication {
+
+namespace CRC {
+
+// Reflected 0xEDB88320 polynomial. The protocol starts from all ones and
+// applies no final inversion.
+const Checksum INITIAL = 0xFFFFFFFF;
+
+Checksum UpdateBitwise(Checksum crc, const uint8_t *data, StringSize length);
+Checksum UpdateNibble(Checksum crc, const uint8_t *data, StringSize length);
+#ifndef __AVR__
+Checksum UpdateSliceBy8(Checksum crc, const uint8_t *data, StringSize length);
+#endif
+
+// The implementation picked by TELECOM_CRC_IMPLEMENTATION
+Checksum Update(Checksum crc, const uint8_t *data, StringSize length);
+Checksum UpdateByte(Checksum crc, uint8_t byte);
+
+class Engine {
+    public:
+        Engine() : crc(INITIAL) {}
+
+        inline void Reset() { crc = INITIAL; }
+        inline void Update(uint8_t byte) { crc = UpdateByte(crc, byte); }
+        inline void Update(const void *data, StringSize length) { crc = CRC::Update(crc, (const uint8_t *)data, length); }
+        inline Checksum Value() const { return crc; }
+
+    private:
+        Checksum crc;
+};
+
+} // end namespace CRC
+
+} // end namespace Telecommunication
+
+#endif // __TELECOMMUNICATION_CRC_HPP__
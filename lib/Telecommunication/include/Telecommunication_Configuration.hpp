@@ -13,12 +13,10 @@
 #ifndef __TELECOMMUNICATION_CONFIGURATION_HPP__
 #define __TELECOMMUNICATION_CONFIGURATION_HPP__
 
-#include <Arduino.h>
+#include <Platform.hpp>
 
 // Serial USART Allocation
-#define TC_DEBUG Serial
-
-#define TC_USART Serial1
+#define TC_USART PLATFORM_TELECOM_CONSOLE
 #define TC_BAUD_RATE 9600
 
 // Telecommunication Settings
@@ -27,5 +25,31 @@
 #define TELECOM_CHECKSUM_LENGTH 19
 #define TELECOM_MESSAGE_DELIMITER "\r\r\r"
 #define TELECOM_RAW_ECHO_MODE false
+#define TELECOM_MESSAGE_QUEUE_LENGTH 8
+#define TELECOM_RECEIVE_CHUNK 32
+#define TELECOM_MAX_KEY_VALUES 16
+
+// Receive Slots (one frame being filled, the rest parked for the delegator)
+// Each slot holds a full TELECOM_RECEIVE_BUFFER, so the Mega keeps to two
+#ifndef TELECOM_RECEIVE_SLOTS
+#ifdef __AVR__
+#define TELECOM_RECEIVE_SLOTS 2
+#else
+#define TELECOM_RECEIVE_SLOTS 4
+#endif
+#endif
+
+// CRC32 Implementation
+#define TELECOM_CRC_BITWISE 0
+#define TELECOM_CRC_NIBBLE 1
+#define TELECOM_CRC_SLICE_BY_8 2
+
+#ifndef TELECOM_CRC_IMPLEMENTATION
+#ifdef __AVR__
+#define TELECOM_CRC_IMPLEMENTATION TELECOM_CRC_NIBBLE
+#else
+#define TELECOM_CRC_IMPLEMENTATION TELECOM_CRC_SLICE_BY_8
+#endif
+#endif
 
 #endif // __TELECOMMUNICATION_CONFIGURATION_HPP__
\ No newline at end of file
@@ -30,6 +30,7 @@ class TelecommunicationDelegator {
         void AddInterpreter(Command command, TelecommunicationInterpreter *command_interpreter);
 
         void run();
+        bool step();
 
     private:
         Telecommunication *telecommunicator;
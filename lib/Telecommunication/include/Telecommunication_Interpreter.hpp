@@ -25,13 +25,15 @@ class TelecommunicationInterpreter {
     friend class TelecommunicationDelegator;
 
     public:
-        TelecommunicationInterpreter(const Telecommunication *telecommunicator, const Command command, const Keyword *keywords, const unsigned int keyword_count);
+        TelecommunicationInterpreter(Telecommunication *telecommunicator, const Command command, const Keyword *keywords, const unsigned int keyword_count);
         ~TelecommunicationInterpreter();
 
         virtual void Interpret(TeleMessage message) = 0;
 
     protected:
-        const Telecommunication *telecommunicator;
+        void Reply(TeleMessage message);
+
+        Telecommunication *telecommunicator;
         const Command command;
         const Keyword *keywords;
         const unsigned int keyword_count;
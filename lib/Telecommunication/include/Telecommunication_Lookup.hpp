@@ -0,0 +1,78 @@
+/**
+ ********************************************************************************
+ * @file    Telecommunication_Lookup.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Perfect-Hash Tables for Command and Keyword Decoding
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+// Generated by tools/telecom_lookup_gen.py from Telecommunication_Literals.cpp.
+// Do not edit by hand.
+
+#ifndef __TELECOMMUNICATION_LOOKUP_HPP__
+#define __TELECOMMUNICATION_LOOKUP_HPP__
+
+#include <stdint.h>
+
+#include <Platform.hpp>
+
+#include "Telecommunication_Types.hpp"
+
+namespace Telecommunication {
+
+namespace Lookup {
+
+const uint8_t EMPTY = 0xFF;
+
+// h = h * multiplier + byte over the token, in 16 bits. The bucket hash picks
+// a displacement that is XORed into the slot hash.
+struct PerfectHash {
+    uint16_t bucket_multiplier;
+    uint16_t slot_multiplier;
+    uint8_t bucket_mask;
+    uint8_t slot_mask;
+    const uint8_t *displacement;
+    const uint8_t *slots;
+};
+
+// 35 literals, 64 slots, 16 buckets
+const uint8_t COMMAND_DISPLACEMENT[16] PROGMEM = {
+    0x01, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x10
+};
+
+const uint8_t COMMAND_SLOTS[64] PROGMEM = {
+    0x19, 0x0B, 0x12, 0x09, 0x20, 0x16, 0x0C, 0xFF, 0x0D, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x0E, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x11, 0x04, 0x1E, 0x15, 0xFF, 0xFF, 0xFF,
+    0x10, 0x1C, 0xFF, 0x13, 0x1F, 0x03, 0x07, 0x0F, 0x18, 0x1A, 0x21, 0x17, 0x22, 0x06, 0xFF, 0x02,
+    0xFF, 0x1D, 0xFF, 0xFF, 0xFF, 0x08, 0xFF, 0x05, 0xFF, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01
+};
+
+const PerfectHash COMMAND_HASH = {31, 33, 15, 63, COMMAND_DISPLACEMENT, COMMAND_SLOTS};
+
+static_assert((int)Command::COMMAND_COUNT == 35, "COMMAND tables are stale; rerun tools/telecom_lookup_gen.py");
+
+// 48 literals, 64 slots, 16 buckets
+const uint8_t KEYWORD_DISPLACEMENT[16] PROGMEM = {
+    0x00, 0x01, 0x00, 0x08, 0x03, 0x0E, 0x03, 0x01, 0x06, 0x07, 0x14, 0x10, 0x0C, 0x04, 0x08, 0x00
+};
+
+const uint8_t KEYWORD_SLOTS[64] PROGMEM = {
+    0x27, 0xFF, 0xFF, 0x08, 0x09, 0x03, 0x1E, 0x1C, 0xFF, 0x2C, 0x07, 0x14, 0xFF, 0xFF, 0xFF, 0x0D,
+    0x22, 0xFF, 0x2D, 0xFF, 0x20, 0x2E, 0x13, 0xFF, 0x15, 0xFF, 0x2F, 0xFF, 0xFF, 0x16, 0x12, 0x0F,
+    0x25, 0x05, 0x1F, 0x1D, 0x0A, 0x1B, 0x2B, 0x19, 0x01, 0x04, 0x0E, 0x10, 0x1A, 0x06, 0x18, 0x26,
+    0x0B, 0x17, 0x29, 0x23, 0x11, 0x0C, 0xFF, 0x21, 0x00, 0xFF, 0x24, 0xFF, 0x28, 0x02, 0x2A, 0xFF
+};
+
+const PerfectHash KEYWORD_HASH = {43, 33, 15, 63, KEYWORD_DISPLACEMENT, KEYWORD_SLOTS};
+
+static_assert((int)Keyword::KEYWORD_COUNT == 48, "KEYWORD tables are stale; rerun tools/telecom_lookup_gen.py");
+
+} // end namespace Lookup
+
+} // end namespace Telecommunication
+
+#endif // __TELECOMMUNICATION_LOOKUP_HPP__
@@ -34,6 +34,7 @@ enum class Command {
     TC_SET_SINGULARITY,
     TC_SET_ERROR,
     TC_CLEAR_ERRORS,
+    TC_SET_LINK,
     // Telemetry Requests
     TR_GET,
     TR_GET_TARGET,
@@ -59,6 +60,7 @@ enum class Command {
     TR_CORALS_STATE,
     TR_ATTITUDE,
     TR_ERROR_STATE,
+    TR_LINK_STATE,
     // Other Values
     COMMAND_COUNT,
     NO_COMMAND,
@@ -81,6 +83,14 @@ enum class Keyword {
     KW_GAIN33,
     KW_GM_MASTER_POWER,
     KW_HALT_STATUS,
+    KW_HEAP_FREE,
+    KW_HEAP_LARGEST,
+    KW_IDLE_FRACTION,
+    KW_LINK_MODE,
+    KW_MEMORY_ALLOCS,
+    KW_MEMORY_LIVE,
+    KW_MEMORY_NAME,
+    KW_MEMORY_PEAK,
     KW_Q0,
     KW_Q1,
     KW_Q2,
@@ -93,7 +103,19 @@ enum class Keyword {
     KW_SINGULARITY_THOLD,
     KW_SINGULARITY_TRIP,
     KW_SM_MASTER_POWER,
+    KW_STACK_HIGH_WATER,
     KW_TARGET_NUM,
+    KW_TASK_CALLS,
+    KW_TASK_EVENTS,
+    KW_TASK_EXEC_AVG,
+    KW_TASK_EXEC_MAX,
+    KW_TASK_EXEC_MIN,
+    KW_TASK_ID,
+    KW_TASK_JITTER_AVG,
+    KW_TASK_JITTER_MAX,
+    KW_TASK_NAME,
+    KW_TASK_OVERRUNS,
+    KW_TX_OVERFLOWS,
     // Other Values
     KEYWORD_COUNT,
     NO_KEYWORD
@@ -129,6 +151,11 @@ extern "C" typedef struct KeywordParameter {
     };
 } KeywordParameter_t;
 
+enum class LinkMode : uint8_t {
+    ASCII,
+    BINARY
+};
+
 struct KeyValue {
     Keyword keyword;
     ParameterType type;
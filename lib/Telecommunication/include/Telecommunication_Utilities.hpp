@@ -22,7 +22,7 @@ CString GetCommandLiteral(Command command);
 CString GetKeywordLiteral(Keyword keyword);
 KeywordParameter_t GetKeywordParameter(Keyword keyword);
 
-Checksum crc32(String data, StringSize length);
+Checksum crc32(CString data, StringSize length);
 
 namespace Decoding {
 
@@ -32,6 +32,9 @@ bool VerifyCommaDelimiter(String &ptr);
 Command GetCommand(String &ptr);
 Keyword GetKeyword(String &ptr);
 
+bool InDomain(const KeywordParameter_t &parameter, long int value);
+bool InDomain(const KeywordParameter_t &parameter, double value);
+
 } // namespace Decoding
 
 } // namespace Telecommunication
@@ -14,84 +14,263 @@
 
 #include <ctype.h>
 #include <math.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-#include <Queue.tpp>
+#include <Logging.hpp>
+#include <Platform_Memory.hpp>
+#include <StaticQueue.tpp>
 
+#include "Telecommunication_Binary.hpp"
 #include "Telecommunication_Configuration.hpp"
+#include "Telecommunication_CRC.hpp"
 #include "Telecommunication_Literals.hpp"
 #include "Telecommunication_Types.hpp"
 #include "Telecommunication_Utilities.hpp"
 
 namespace Telecommunication {
 
-Telecommunication::Telecommunication() : ReceiveBufferIndex(0) {
+Platform::Memory::Counter TX_MEMORY("Telecom_Transmit");
+
+namespace {
+
+// dtostrf is unbounded, so decimals are limited to the float range
+const double DECIMAL_LIMIT = 1e38;
+const StringSize DECIMAL_LENGTH = 48;
+
+// Writes at ptr if the whole text fits before end, otherwise leaves ptr unchanged
+bool Append(char *&ptr, const char *end, CString format, ...) {
+    if (ptr >= end) return false;
+
+    va_list arguments;
+    va_start(arguments, format);
+    int length = vsnprintf(ptr, end - ptr, format, arguments);
+    va_end(arguments);
+
+    if (length < 0 || length >= end - ptr) {
+        *ptr = '\0';
+        return false;
+    }
+    ptr += length;
+    return true;
+}
+
+bool AppendPair(char *&ptr, const char *end, const KeyValue &key_value) {
+    const KeywordParameter keyword_parameter = GetKeywordParameter(key_value.keyword);
+
+    // Set Delimiter and Keyword
+    if (!Append(ptr, end, "%s%s ", KEYVALUE_DELIMITER, GetKeywordLiteral(key_value.keyword))) return false;
+
+    // Set Value
+    switch (keyword_parameter.datatype) {
+        case ParameterType::INTEGER:
+            return Append(ptr, end, "%ld", key_value.value.integer);
+        case ParameterType::DECIMAL: {
+            if (!(fabs(key_value.value.decimal) < DECIMAL_LIMIT)) return false;
+            char decimal[DECIMAL_LENGTH];
+            dtostrf(key_value.value.decimal, 1, 6, decimal);
+            return Append(ptr, end, "%s", decimal);
+        }
+        case ParameterType::STRING:
+            return Append(ptr, end, "%s", key_value.value.string);
+        default:
+            return true;
+    }
+}
+
+} // end namespace
+
+
+Telecommunication::Telecommunication() : Mode(LinkMode::ASCII), ReceiveSlot(0), ReceiveIndex(0), DelimiterMatched(0),
+                                         State(FrameState::FILLING), FrameMode(LinkMode::ASCII), FrameText(true) {
+    memset(&Statistics, 0, sizeof(Statistics));
     TC_USART.begin(TC_BAUD_RATE);
 };
 
 Telecommunication::~Telecommunication() {};
 
 void Telecommunication::Receive(unsigned int count) {
+    if (count == 0) {
+        uint8_t buffer[TELECOM_RECEIVE_CHUNK];
+        int available;
+        while ((available = TC_USART.available()) > 0) {
+            size_t length = TC_USART.readBytes(buffer, ((unsigned int)available < sizeof(buffer)) ? available : sizeof(buffer));
+            if (length == 0) break;
+            Feed(buffer, length);
+        }
+        return;
+    }
+
     unsigned int messages_received = 0;
-    for (unsigned int &i = ReceiveBufferIndex; i < TELECOM_RECEIVE_BUFFER && TC_USART.available() && (count == 0 || messages_received < count); i++) {
-        ReceiveBuffer[i] = TC_USART.read();
-        if (strncmp(&ReceiveBuffer[i - 2], TELECOM_MESSAGE_DELIMITER, 3) == 0) {
-            ReceiveBuffer[i - 2] = '\0';
-            char *new_string = new char[i -2];
-            strncpy(new_string, ReceiveBuffer, i - 2);
-            ReceiveQueue.push(new_string);
-            i = 0;
-            messages_received++;
+    while (messages_received < count && TC_USART.available()) {
+        if (Feed((uint8_t)TC_USART.read())) messages_received++;
+    }
+}
+
+bool Telecommunication::Feed(uint8_t byte) {
+    // A frame is read in the mode that was current when it began
+    if (ReceiveIndex == 0 && DelimiterMatched == 0 && State == FrameState::FILLING) {
+        FrameMode = Mode;
+        FrameText = true;
+    }
+
+    // The delimiter is one repeated character, so a mismatch always restarts the match
+    DelimiterMatched = (byte == (uint8_t)TELECOM_MESSAGE_DELIMITER[DelimiterMatched]) ? DelimiterMatched + 1 : 0;
+    bool delimited = DelimiterMatched == DELIMITER_LENGTH;
+    if (delimited) DelimiterMatched = 0;
+
+    // A binary link still takes ASCII frames, told apart as printable text
+    // ending in the ASCII delimiter, so a SET_LINK back to ASCII always gets
+    // through. Either delimiter ends a discarded frame.
+    if (FrameMode == LinkMode::BINARY) {
+        if (delimited && FrameText) {
+            FrameMode = LinkMode::ASCII;
+        }
+        else {
+            delimited = byte == Binary::DELIMITER || (delimited && State == FrameState::DISCARDING);
+            FrameText = FrameText && (isprint(byte) || byte == '\r');
         }
     }
-    if (ReceiveBufferIndex == TELECOM_RECEIVE_BUFFER) ReceiveBufferIndex = 0;
+
+    if (State == FrameState::DISCARDING) {
+        Statistics.discarded++;
+        if (delimited) {
+            Statistics.resyncs++;
+            State = FrameState::FILLING;
+        }
+        return false;
+    }
+
+    // A frame may only start in a free slot; slots are never taken back from
+    // the producer once it has begun writing one
+    if (ReceiveIndex == 0 && ReceiveReady.full()) {
+        Statistics.overruns++;
+        Statistics.discarded++;
+        if (!delimited) State = FrameState::DISCARDING;
+        return false;
+    }
+
+    FrameSlot &frame = ReceiveFrames[ReceiveSlot];
+    if (delimited) {
+        unsigned int length = (FrameMode == LinkMode::BINARY) ? ReceiveIndex : ReceiveIndex + 1 - DELIMITER_LENGTH;
+        ReceiveIndex = 0;
+        if (length == 0) return false;
+        frame.data[length] = '\0';
+        frame.length = length;
+        frame.checksum = ReceiveCRC.Value();
+        frame.mode = FrameMode;
+        ReceiveReady.push(ReceiveSlot);
+        ReceiveSlot = (ReceiveSlot + 1) % TELECOM_RECEIVE_SLOTS;
+        Statistics.frames++;
+        return true;
+    }
+
+    // Delimiter bytes are stored until the match completes and the last byte
+    // of a slot is kept for the terminator
+    if (ReceiveIndex == TELECOM_RECEIVE_BUFFER - 1) {
+        Statistics.oversize++;
+        Statistics.discarded += ReceiveIndex + 1;
+        ReceiveIndex = 0;
+        State = FrameState::DISCARDING;
+        return false;
+    }
+
+    // Binary frames carry their checksum inside the encoding and are checked
+    // once decoded; the lagged CRC only runs while the frame may be ASCII
+    if (FrameMode == LinkMode::ASCII || FrameText) {
+        if (ReceiveIndex == 0) ReceiveCRC.Reset();
+        else if (ReceiveIndex >= CHECKSUM_LAG) ReceiveCRC.Update((uint8_t)frame.data[ReceiveIndex - CHECKSUM_LAG]);
+    }
+    frame.data[ReceiveIndex++] = byte;
+    return false;
+}
+
+unsigned int Telecommunication::Feed(const uint8_t *buffer, size_t length) {
+    unsigned int frames = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (Feed(buffer[i])) frames++;
+    }
+    return frames;
 }
 
 void Telecommunication::Transmit(unsigned int count) {
-    MessageQueue &OperatingQueue = TELECOM_RAW_ECHO_MODE ? ReceiveQueue : TransmitQueue;
-    for (unsigned int i = 0; (count == 0 || i < count) && !OperatingQueue.empty(); i++) {
-        TC_USART.print(OperatingQueue.pop());
+    for (unsigned int i = 0; (count == 0 || i < count); i++) {
+        if (TELECOM_RAW_ECHO_MODE) {
+            uint8_t slot;
+            if (!ReceiveReady.peek(slot)) break;
+            TC_USART.print(ReceiveFrames[slot].data);
+            SendDelimiter(ReceiveFrames[slot].mode);
+            ReceiveReady.pop(slot);
+        }
+        else {
+            if (TransmitQueue.empty()) break;
+            OutgoingFrame frame = TransmitQueue.pop();
+            TC_USART.print(frame.string);
+            SendDelimiter(frame.mode);
+            delete[] frame.string;
+            TX_MEMORY.Freed();
+        }
+    }
+}
+
+void Telecommunication::SendDelimiter(LinkMode mode) {
+    if (mode == LinkMode::BINARY) {
+        TC_USART.write((uint8_t)Binary::DELIMITER);
+    }
+    else {
         TC_USART.print(TELECOM_MESSAGE_DELIMITER);
     }
 }
 
-TeleMessage Telecommunication::GetReception() {
+// The slot stays with the consumer until the frame is parsed; nothing in the
+// message refers into it afterwards
+bool Telecommunication::GetReception(TeleMessage &message) {
+    uint8_t slot;
+    if (!ReceiveReady.peek(slot)) return false;
+
+    FrameSlot &frame = ReceiveFrames[slot];
+    if (frame.mode == LinkMode::BINARY) {
+        message = Binary::Decode((uint8_t *)frame.data, frame.length, ReceivedPairs, TELECOM_MAX_KEY_VALUES);
+    }
+    else {
+        message = Parse(frame.data, frame.checksum);
+    }
+    ReceiveReady.pop(slot);
+
+    return true;
+}
+
+TeleMessage Telecommunication::Parse(String string, Checksum expected_checksum) {
     using namespace Decoding;
 
     TeleMessage retval;
-
-    // Get Message from Queue
-    String string = NULL;
-    ReceiveQueue.pop(string);
-    if (string == NULL) {
+    retval.key_value_pairs = ReceivedPairs;
+    retval.pair_count = 0;
+    String ptr = (String) string;
+    StringSize length = strlen(string);
+    if (length < TELECOM_CHECKSUM_LENGTH) {
         retval.valid = false;
         return retval;
     }
-    String ptr = (String) string;
-    StringSize length = strlen(string);
-    Checksum expected_checksum = crc32(ptr, length-TELECOM_CHECKSUM_LENGTH);
             
     // Verify Target is CORALS
     if (!VerifyTarget(ptr)) {
         retval.valid = false;
-        delete[] string;
         return retval;
     }
 
     // Verify Delimiter
     if (!VerifyDotDelimiter(ptr)) {
         retval.valid = false;
-        delete[] string;
         return retval;
     }
 
     // Verify Checksum
-    uint32_t checksum = strtol(string + length - 8, NULL, 16);
+    uint32_t checksum = strtoul(string + length - 8, NULL, 16);
     if (checksum != expected_checksum) {
         retval.valid = false;
-        delete[] string;
         return retval;
     }
 
@@ -99,32 +278,31 @@ TeleMessage Telecommunication::GetReception() {
     retval.command = GetCommand(ptr);
     if (retval.command == Command::NO_COMMAND) {
         retval.valid = false;
-        delete[] string;
         return retval;
     }
 
     // Verify Delimiter
     if (!VerifyCommaDelimiter(ptr)) {
         retval.valid = false;
-        delete[] string;
         return retval;
     }
 
     // Get Key Value Pairs
     bool end_of_message = false;
-    DataStructures::Queue<KeyValue> key_value_pairs;
     do {
         // Get Keyword
         KeyValue key_value;
         key_value.keyword = GetKeyword(ptr);
         if (key_value.keyword == Keyword::NO_KEYWORD) {
             retval.valid = false;
-            delete[] string;
             return retval;
         }
 
         const KeywordParameter keyword_parameter = GetKeywordParameter(key_value.keyword);
 
+        // Skip Separator
+        if (*ptr == ' ') ptr++;
+
         // Get Value
         key_value.type = keyword_parameter.datatype;
         String tmp = ptr;
@@ -135,7 +313,6 @@ TeleMessage Telecommunication::GetReception() {
                 value.integer = strtol(tmp, &ptr, 10);
                 if (tmp == ptr) {
                     retval.valid = false;
-                    delete[] string;
                     return retval;
                 }
                 switch (keyword_parameter.domain) {
@@ -148,7 +325,6 @@ TeleMessage Telecommunication::GetReception() {
                         }
                         if (i == keyword_parameter.length) {
                             retval.valid = false;
-                            delete[] string;
                             return retval;
                         }
                         break;
@@ -158,7 +334,6 @@ TeleMessage Telecommunication::GetReception() {
                         }
                         else {
                             retval.valid = false;
-                            delete[] string;
                             return retval;
                         }
                         break;
@@ -167,7 +342,6 @@ TeleMessage Telecommunication::GetReception() {
                         break;
                     default:
                         retval.valid = false;
-                        delete[] string;
                         return retval;
                 }
                 break;
@@ -175,7 +349,6 @@ TeleMessage Telecommunication::GetReception() {
                 value.decimal = strtod(tmp, &ptr);
                 if (tmp == ptr) {
                     retval.valid = false;
-                    delete[] string;
                     return retval;
                 }
                 switch (keyword_parameter.domain) {
@@ -183,13 +356,11 @@ TeleMessage Telecommunication::GetReception() {
                         for (; i < keyword_parameter.length; i++) {
                             if (value.decimal == keyword_parameter.decimal[i]) {
                                 key_value.value.decimal = value.decimal;
-                                delete[] string;
                                 break;
                             }
                         }
                         if (i == keyword_parameter.length) {
                             retval.valid = false;
-                            delete[] string;
                             return retval;
                         }
                         break;
@@ -199,7 +370,6 @@ TeleMessage Telecommunication::GetReception() {
                         }
                         else {
                             retval.valid = false;
-                            delete[] string;
                             return retval;
                         }
                         break;
@@ -208,7 +378,6 @@ TeleMessage Telecommunication::GetReception() {
                         break;
                     default:
                         retval.valid = false;
-                        delete[] string;
                         return retval;
                 }
                 break;
@@ -223,20 +392,17 @@ TeleMessage Telecommunication::GetReception() {
                         }
                         if (i == keyword_parameter.length) {
                             retval.valid = false;
-                            delete[] string;
                             return retval;
                         }
                         ptr += strlen(key_value.value.string);
                         break;
                     default:
                         retval.valid = false;
-                        delete[] string;
                         return retval;
                 }
                 break;
             default:
                 retval.valid = false;
-                delete[] string;
                 return retval;
         }
 
@@ -247,102 +413,100 @@ TeleMessage Telecommunication::GetReception() {
             end_of_message = true;
         } else {
             retval.valid = false;
-            delete[] string;
             return retval;
         }
 
         // Add Key Value Pair to List
-        key_value_pairs.push(key_value);
+        if (retval.pair_count == TELECOM_MAX_KEY_VALUES) {
+            retval.valid = false;
+            return retval;
+        }
+        ReceivedPairs[retval.pair_count++] = key_value;
 
     } while (!end_of_message);
 
-    // Parse Key Value Pairs
-    retval.pair_count = key_value_pairs.size();
-    retval.key_value_pairs = new KeyValue[retval.pair_count];
-    for (unsigned int i = 0; i < retval.pair_count; i++) {
-        retval.key_value_pairs[i] = key_value_pairs.pop();
-    }
-
     // Set Checksum
     retval.checksum = expected_checksum;
 
     // Set Valid
     retval.valid = true;
 
-    // Clean Up
-    delete[] string;
-
     return retval;
 }
 
 void Telecommunication::SendTransmission(TeleMessage message) {
+    if (Mode == LinkMode::BINARY) {
+        SendBinaryTransmission(message);
+        return;
+    }
 
-    const char *string = new char[TELECOM_TRANSMIT_BUFFER];
-    char *ptr = (char *)string;
-
-    // Set Target
-    strncpy(ptr, DESTINATION, DESTINATION_LENGTH);
-    ptr += DESTINATION_LENGTH;
-
-    // Set Delimiter
-    strncpy(ptr, COMMAND_DELIMITER, COMMAND_DELIMITER_LENGTH);
-    ptr += COMMAND_DELIMITER_LENGTH;
-
-    // Set Command
-    CString command = GetCommandLiteral(message.command);
-    strncpy(ptr, command, strlen(command));
-    ptr += strlen(command);
-
-    // Set Key Value Pairs
-    for (unsigned int i = 0; i < message.pair_count; i++) {
-        const KeyValue key_value = message.key_value_pairs[i];
-        const KeywordParameter keyword_parameter = GetKeywordParameter(key_value.keyword);
-
-        // Set Delimiter
-        strncpy(ptr, KEYVALUE_DELIMITER, KEYVALUE_DELIMITER_LENGTH);
-        ptr += KEYVALUE_DELIMITER_LENGTH;
-
-        // Set Keyword
-        CString literal = GetKeywordLiteral(key_value.keyword);
-        strncpy(ptr, literal, strlen(literal));
-        ptr += strlen(literal);
-        *ptr++ = ' '; 
-
-        // Set Value
-        int pre_decimal_length = 0;
-        switch (keyword_parameter.datatype) {
-            case ParameterType::INTEGER:
-                ptr += sprintf(ptr, "%ld", key_value.value.integer);
-                break;
-            case ParameterType::DECIMAL:
-                pre_decimal_length = ceil(log10(key_value.value.decimal));
-                dtostrf(key_value.value.decimal, pre_decimal_length + 7, 6, ptr);
-                ptr += pre_decimal_length + 7;
-                break;
-            case ParameterType::STRING:
-                strncpy(ptr, key_value.value.string, strlen(key_value.value.string));
-                ptr += strlen(key_value.value.string);
-                break;
-            default:
-                break;
+    // Pairs that would overrun the buffer continue in a further frame with the
+    // same command; a pair too long for a frame of its own is dropped
+    unsigned int pair = 0;
+    do {
+        char *string = new char[TELECOM_TRANSMIT_BUFFER];
+        TX_MEMORY.Allocated();
+        char *ptr = string;
+
+        // Room for the checksum and terminator is kept back for the end
+        const char *end = string + TELECOM_TRANSMIT_BUFFER - TELECOM_CHECKSUM_LENGTH;
+
+        // Set Target, Delimiter and Command
+        Append(ptr, end, "%s%s%s", DESTINATION, COMMAND_DELIMITER, GetCommandLiteral(message.command));
+
+        CRC::Engine crc;
+        crc.Update(string, ptr - string);
+
+        // Set Key Value Pairs
+        unsigned int frame_pairs = 0;
+        for (; pair < message.pair_count; pair++) {
+            char *pair_start = ptr;
+            if (!AppendPair(ptr, end, message.key_value_pairs[pair])) {
+                ptr = pair_start;
+                if (frame_pairs > 0) break;
+                continue;
+            }
+            crc.Update(pair_start, ptr - pair_start);
+            frame_pairs++;
         }
 
-    }
+        // Set Delimiter and Checksum
+        Append(ptr, string + TELECOM_TRANSMIT_BUFFER, "%sCRC32 0x%08lX", COMMAND_DELIMITER, (unsigned long)crc.Value());
 
-    Checksum checksum = crc32((String)string, strlen(string));
+        Enqueue(string, LinkMode::ASCII);
+    } while (pair < message.pair_count);
+}
 
-    // Set Delimiter
-    strncpy(ptr, COMMAND_DELIMITER, COMMAND_DELIMITER_LENGTH);
-    ptr += COMMAND_DELIMITER_LENGTH;
+// COBS output never contains the zero delimiter, so it is still a C string
+void Telecommunication::SendBinaryTransmission(TeleMessage message) {
+    char *string = new char[TELECOM_TRANSMIT_BUFFER];
+    TX_MEMORY.Allocated();
 
-    // Set Checksum
-    ptr += sprintf(ptr, "CRC32 0x%08lX", checksum);
+    StringSize length = Binary::Encode(message, (uint8_t *)string, TELECOM_TRANSMIT_BUFFER - 1);
+    if (length == 0) {
+        delete[] string;
+        TX_MEMORY.Freed();
+        return;
+    }
+    string[length] = '\0';
 
-    // Set End of String
-    *ptr = '\0';
+    Enqueue(string, LinkMode::BINARY);
+}
 
-    // Add to Transmit Queue
-    TransmitQueue.push((String) string);
+// A reply longer than the queue, such as a full GET_STATE, sends its oldest
+// frames on the spot rather than losing the newest
+void Telecommunication::Enqueue(String string, LinkMode mode) {
+    OutgoingFrame frame;
+    frame.string = string;
+    frame.mode = mode;
+    if (TransmitQueue.push(frame)) return;
+
+    LOG_WARNING(TELECOM_TRANSMIT_FLUSHED, TransmitQueue.overflows());
+    Transmit(1);
+    if (!TransmitQueue.push(frame)) {
+        delete[] string;
+        TX_MEMORY.Freed();
+    }
 }
 
 } // end namespace Telecommunication
\ No newline at end of file
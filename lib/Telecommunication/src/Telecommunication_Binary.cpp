@@ -0,0 +1,227 @@
+/**
+ ********************************************************************************
+ * @file    Telecommunication_Binary.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Binary Framing for the Telecommunication Link
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Telecommunication_Binary.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "Telecommunication_CRC.hpp"
+#include "Telecommunication_Literals.hpp"
+#include "Telecommunication_Types.hpp"
+#include "Telecommunication_Utilities.hpp"
+
+namespace Telecommunication {
+
+namespace Binary {
+
+namespace {
+
+const StringSize CHECKSUM_BYTES = 4;
+
+// Stuffs bytes as they are produced, so the frame is encoded in one pass
+// with no staging buffer. Writes past capacity are dropped and reported by
+// Finish().
+class CobsWriter {
+    public:
+        CobsWriter(uint8_t *output, StringSize capacity) : output(output), capacity(capacity), code_index(0), length(1) {}
+
+        void Put(uint8_t byte) {
+            if (byte == 0) {
+                Close();
+                return;
+            }
+            Store(byte);
+            if (length - code_index == 0xFF) Close();
+        }
+
+        StringSize Finish() {
+            if (code_index < capacity) output[code_index] = length - code_index;
+            return (length <= capacity) ? length : 0;
+        }
+
+    private:
+        inline void Store(uint8_t byte) {
+            if (length < capacity) output[length] = byte;
+            length++;
+        }
+        inline void Close() {
+            if (code_index < capacity) output[code_index] = length - code_index;
+            code_index = length++;
+        }
+
+        uint8_t *output;
+        StringSize capacity;
+        StringSize code_index;
+        StringSize length;
+};
+
+class FrameWriter {
+    public:
+        FrameWriter(uint8_t *frame, StringSize capacity) : cobs(frame, capacity) {}
+
+        inline void Put(uint8_t byte) {
+            crc.Update(byte);
+            cobs.Put(byte);
+        }
+        inline void Put32(uint32_t value) {
+            for (uint8_t i = 0; i < 4; i++) Put(value >> (8 * i));
+        }
+
+        StringSize Finish() {
+            Checksum checksum = crc.Value();
+            for (uint8_t i = 0; i < CHECKSUM_BYTES; i++) cobs.Put(checksum >> (8 * i));
+            return cobs.Finish();
+        }
+
+    private:
+        CobsWriter cobs;
+        CRC::Engine crc;
+};
+
+inline uint32_t Read32(const uint8_t *data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+bool SetIndex(const KeywordParameter_t &parameter, CString string, uint8_t &index) {
+    for (StringSize i = 0; i < parameter.length && i < 0xFF; i++) {
+        if (parameter.string[i] == string || strcmp(parameter.string[i], string) == 0) {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // end namespace
+
+StringSize Encode(const TeleMessage &message, uint8_t *frame, StringSize capacity) {
+    FrameWriter writer(frame, capacity);
+    writer.Put((uint8_t)message.command);
+
+    for (unsigned int i = 0; i < message.pair_count; i++) {
+        const KeyValue &key_value = message.key_value_pairs[i];
+        const KeywordParameter_t keyword_parameter = GetKeywordParameter(key_value.keyword);
+        writer.Put((uint8_t)key_value.keyword);
+
+        float decimal;
+        uint32_t bits;
+        uint8_t index;
+        StringSize length;
+        switch (keyword_parameter.datatype) {
+            case ParameterType::INTEGER:
+                writer.Put32((uint32_t)(int32_t)key_value.value.integer);
+                break;
+            case ParameterType::DECIMAL:
+                decimal = key_value.value.decimal;
+                memcpy(&bits, &decimal, sizeof(bits));
+                writer.Put32(bits);
+                break;
+            case ParameterType::STRING:
+                if (keyword_parameter.domain == ParameterDomain::SET) {
+                    if (!SetIndex(keyword_parameter, key_value.value.string, index)) return 0;
+                    writer.Put(index);
+                }
+                else {
+                    length = strlen(key_value.value.string);
+                    if (length > 0xFF) length = 0xFF;
+                    writer.Put(length);
+                    for (StringSize j = 0; j < length; j++) writer.Put(key_value.value.string[j]);
+                }
+                break;
+            default:
+                return 0;
+        }
+    }
+
+    return writer.Finish();
+}
+
+TeleMessage Decode(uint8_t *frame, StringSize length, KeyValue *pairs, uint8_t capacity) {
+    TeleMessage retval;
+    retval.key_value_pairs = pairs;
+    retval.pair_count = 0;
+    retval.valid = false;
+
+    // Verify Checksum
+    length = CobsDecode(frame, length);
+    if (length < 1 + CHECKSUM_BYTES) return retval;
+    StringSize end = length - CHECKSUM_BYTES;
+    Checksum expected_checksum = CRC::Update(CRC::INITIAL, frame, end);
+    if (Read32(&frame[end]) != expected_checksum) return retval;
+
+    // Get Command
+    if (frame[0] >= (uint8_t)Command::COMMAND_COUNT) return retval;
+    retval.command = (Command)frame[0];
+
+    // Get Key Value Pairs
+    for (StringSize i = 1; i < end;) {
+        if (retval.pair_count == capacity) return retval;
+        if (frame[i] >= (uint8_t)Keyword::KEYWORD_COUNT) return retval;
+
+        KeyValue key_value;
+        key_value.keyword = (Keyword)frame[i++];
+        const KeywordParameter_t keyword_parameter = GetKeywordParameter(key_value.keyword);
+        key_value.type = keyword_parameter.datatype;
+
+        float decimal;
+        uint32_t bits;
+        switch (key_value.type) {
+            case ParameterType::INTEGER:
+                if (end - i < 4) return retval;
+                key_value.value.integer = (int32_t)Read32(&frame[i]);
+                if (!Decoding::InDomain(keyword_parameter, key_value.value.integer)) return retval;
+                i += 4;
+                break;
+            case ParameterType::DECIMAL:
+                if (end - i < 4) return retval;
+                bits = Read32(&frame[i]);
+                memcpy(&decimal, &bits, sizeof(decimal));
+                key_value.value.decimal = decimal;
+                if (!Decoding::InDomain(keyword_parameter, key_value.value.decimal)) return retval;
+                i += 4;
+                break;
+            case ParameterType::STRING:
+                if (keyword_parameter.domain != ParameterDomain::SET) return retval;
+                if (i >= end) return retval;
+                if (frame[i] >= keyword_parameter.length) return retval;
+                key_value.value.string = keyword_parameter.string[frame[i++]];
+                break;
+            default:
+                return retval;
+        }
+
+        pairs[retval.pair_count++] = key_value;
+    }
+
+    retval.checksum = expected_checksum;
+    retval.valid = true;
+    return retval;
+}
+
+// Decoding never writes ahead of where it reads, so it works in place.
+// Returns 0 for a malformed frame.
+StringSize CobsDecode(uint8_t *buffer, StringSize length) {
+    StringSize read = 0;
+    StringSize write = 0;
+    while (read < length) {
+        uint8_t code = buffer[read++];
+        if (code == 0 || (StringSize)(code - 1) > length - read) return 0;
+        for (uint8_t i = 1; i < code; i++) buffer[write++] = buffer[read++];
+        if (code < 0xFF && read < length) buffer[write++] = 0;
+    }
+    return write;
+}
+
+} // end namespace Binary
+
+} // end namespace Telecommunication
@@ -0,0 +1,137 @@
+/**
+ ********************************************************************************
+ * @file    Telecommunication_CRC.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Streaming CRC32 Engine
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Telecommunication_CRC.hpp"
+
+#include <Platform.hpp>
+
+#include "Telecommunication_Configuration.hpp"
+#include "Telecommunication_Types.hpp"
+
+namespace Telecommunication {
+
+namespace CRC {
+
+namespace {
+
+const Checksum POLYNOMIAL = 0xEDB88320;
+
+// CRC of each nibble value, 64 bytes of flash
+const Checksum NIBBLE_TABLE[16] PROGMEM = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+inline Checksum StepBitwise(Checksum crc, uint8_t byte) {
+    crc ^= byte;
+    for (uint8_t j = 0; j < 8; j++) {
+        Checksum mask = -(crc & 1);
+        crc = (crc >> 1) ^ (POLYNOMIAL & mask);
+    }
+    return crc;
+}
+
+inline Checksum StepNibble(Checksum crc, uint8_t byte) {
+    crc ^= byte;
+    crc = (crc >> 4) ^ pgm_read_dword(&NIBBLE_TABLE[crc & 0x0F]);
+    crc = (crc >> 4) ^ pgm_read_dword(&NIBBLE_TABLE[crc & 0x0F]);
+    return crc;
+}
+
+#ifndef __AVR__
+
+// Table k advances a byte through k further zero bytes, so eight input
+// bytes fold in with eight independent lookups. 8 KiB, built on first use.
+struct SliceTables {
+    Checksum table[8][256];
+
+    SliceTables() {
+        for (unsigned int i = 0; i < 256; i++) table[0][i] = StepBitwise(0, i);
+        for (unsigned int k = 1; k < 8; k++) {
+            for (unsigned int i = 0; i < 256; i++) {
+                Checksum previous = table[k - 1][i];
+                table[k][i] = (previous >> 8) ^ table[0][previous & 0xFF];
+            }
+        }
+    }
+};
+
+inline const SliceTables& Slices() {
+    static const SliceTables tables;
+    return tables;
+}
+
+inline Checksum StepSlice(const SliceTables &tables, Checksum crc, uint8_t byte) {
+    return (crc >> 8) ^ tables.table[0][(crc ^ byte) & 0xFF];
+}
+
+#endif
+
+} // end namespace
+
+Checksum UpdateBitwise(Checksum crc, const uint8_t *data, StringSize length) {
+    for (StringSize i = 0; i < length; i++) crc = StepBitwise(crc, data[i]);
+    return crc;
+}
+
+Checksum UpdateNibble(Checksum crc, const uint8_t *data, StringSize length) {
+    for (StringSize i = 0; i < length; i++) crc = StepNibble(crc, data[i]);
+    return crc;
+}
+
+#ifndef __AVR__
+
+Checksum UpdateSliceBy8(Checksum crc, const uint8_t *data, StringSize length) {
+    const SliceTables &tables = Slices();
+    const Checksum (*t)[256] = tables.table;
+
+    for (; length >= 8; data += 8, length -= 8) {
+        Checksum one = crc ^ ((Checksum)data[0] | ((Checksum)data[1] << 8) | ((Checksum)data[2] << 16) | ((Checksum)data[3] << 24));
+        Checksum two = (Checksum)data[4] | ((Checksum)data[5] << 8) | ((Checksum)data[6] << 16) | ((Checksum)data[7] << 24);
+        crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+              t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+    }
+    for (; length > 0; data++, length--) crc = StepSlice(tables, crc, *data);
+
+    return crc;
+}
+
+#endif
+
+#if TELECOM_CRC_IMPLEMENTATION == TELECOM_CRC_BITWISE
+
+Checksum Update(Checksum crc, const uint8_t *data, StringSize length) { return UpdateBitwise(crc, data, length); }
+Checksum UpdateByte(Checksum crc, uint8_t byte) { return StepBitwise(crc, byte); }
+
+#elif TELECOM_CRC_IMPLEMENTATION == TELECOM_CRC_NIBBLE
+
+Checksum Update(Checksum crc, const uint8_t *data, StringSize length) { return UpdateNibble(crc, data, length); }
+Checksum UpdateByte(Checksum crc, uint8_t byte) { return StepNibble(crc, byte); }
+
+#elif TELECOM_CRC_IMPLEMENTATION == TELECOM_CRC_SLICE_BY_8
+
+#ifdef __AVR__
+#error "TELECOM_CRC_SLICE_BY_8 needs 8 KiB of tables and is not available on AVR"
+#endif
+
+Checksum Update(Checksum crc, const uint8_t *data, StringSize length) { return UpdateSliceBy8(crc, data, length); }
+Checksum UpdateByte(Checksum crc, uint8_t byte) { return StepSlice(Slices(), crc, byte); }
+
+#else
+#error "Unknown TELECOM_CRC_IMPLEMENTATION"
+#endif
+
+} // end namespace CRC
+
+} // end namespace Telecommunication
@@ -22,7 +22,7 @@
 namespace Telecommunication {
 
 TelecommunicationDelegator::TelecommunicationDelegator(Telecommunication *telecommunicator) : telecommunicator(telecommunicator) {
-    for (int i = 0; i < (int)Command::COMMAND_COUNT; i++) {
+    for (int i = 0; i < (int)Command::RECEIVING_COMMAND_COUNT; i++) {
         interpreters[i] = nullptr;
     }
 }
@@ -34,11 +34,18 @@ void TelecommunicationDelegator::AddInterpreter(Command command, Telecommunicati
 }
 
 void TelecommunicationDelegator::run() {
-    TeleMessage message; 
-    do {
-        telecommunicator->GetReception();
-        if (message.valid) interpreters[(int)message.command]->Interpret(message);
-    } while (message.valid);
+    while (step());
+}
+
+bool TelecommunicationDelegator::step() {
+    TeleMessage message;
+    if (!telecommunicator->GetReception(message)) return false;
+    if (!message.valid) return true;
+
+    if (message.command < Command::RECEIVING_COMMAND_COUNT && interpreters[(int)message.command] != nullptr) {
+        interpreters[(int)message.command]->Interpret(message);
+    }
+    return true;
 }
 
 } // end namespace Telecommunication
\ No newline at end of file
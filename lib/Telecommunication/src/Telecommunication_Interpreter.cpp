@@ -12,13 +12,14 @@
 
 #include "Telecommunication_Interpreter.hpp"
 
+#include "Telecommunication.hpp"
 #include "Telecommunication_Literals.hpp"
 #include "Telecommunication_Types.hpp"
 #include "Telecommunication_Utilities.hpp"
 
 namespace Telecommunication {
 
-TelecommunicationInterpreter::TelecommunicationInterpreter(const Telecommunication *telecommunicator,
+TelecommunicationInterpreter::TelecommunicationInterpreter(Telecommunication *telecommunicator,
                                                            const Command command, 
                                                            const Keyword *keywords, 
                                                            const unsigned int keyword_count)
@@ -26,4 +27,8 @@ TelecommunicationInterpreter::TelecommunicationInterpreter(const Telecommunicati
 
 TelecommunicationInterpreter::~TelecommunicationInterpreter() {}
 
+void TelecommunicationInterpreter::Reply(TeleMessage message) {
+    telecommunicator->SendTransmission(message);
+}
+
 } // end namespace Telecommunication
\ No newline at end of file
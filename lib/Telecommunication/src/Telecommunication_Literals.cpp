@@ -0,0 +1,186 @@
+/**
+ ********************************************************************************
+ * @file    Telecommunication_Literals.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   String Literals for Telecommunication
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include "Telecommunication_Literals.hpp"
+
+#include <string.h>
+
+#include "Telecommunication_Types.hpp"
+
+namespace Telecommunication {
+
+CString RECEIVER = "CORALS";
+const StringSize RECEIVER_LENGTH = strlen(RECEIVER);
+CString DESTINATION = "DARTS";
+const StringSize DESTINATION_LENGTH = strlen(DESTINATION);
+CString COMMAND_DELIMITER = " . ";
+const StringSize COMMAND_DELIMITER_LENGTH = strlen(COMMAND_DELIMITER);
+CString KEYVALUE_DELIMITER = ", ";
+const StringSize KEYVALUE_DELIMITER_LENGTH = strlen(KEYVALUE_DELIMITER);
+
+CString CommandLiterals[(int)Command::COMMAND_COUNT] = {
+    "SET",
+    "ECHO",
+    "TARGET_ADD",
+    "HALT",
+    "SET_POWER",
+    "SET_INERTIA",
+    "SET_CONTROL",
+    "SET_SINGULARITY",
+    "SET_ERROR",
+    "CLEAR_ERRORS",
+    "SET_LINK",
+    "GET",
+    "GET_TARGET",
+    "GET_HALT",
+    "GET_POWER",
+    "GET_INERTIA",
+    "GET_CONTROL",
+    "GET_SINGULARITY",
+    "GET_STATE",
+    "GET_ATTITUDE",
+    "GET_ERROR",
+    "GET_ERRORS",
+    "REGISTER",
+    "ECHO_REPLY",
+    "CURRENT_TARGET",
+    "TARGET_LIST",
+    "HALT_STATE",
+    "POWER_STATE",
+    "INERTIA_MATRIX",
+    "CONTROL_STATE",
+    "SINGULARITY_STATE",
+    "CORALS_STATE",
+    "ATTITUDE",
+    "ERROR_STATE",
+    "LINK_STATE"
+};
+
+CString KeywordLiterals[(int)Keyword::KEYWORD_COUNT] = {
+    "ARGUMENT_ERROR",
+    "COMM_LR",
+    "CONTROL_LR",
+    "ENABLE_OVERRIDE",
+    "GAIN11",
+    "GAIN12",
+    "GAIN13",
+    "GAIN21",
+    "GAIN22",
+    "GAIN23",
+    "GAIN31",
+    "GAIN32",
+    "GAIN33",
+    "GM_MASTER_POWER",
+    "HALT_STATUS",
+    "HEAP_FREE",
+    "HEAP_LARGEST",
+    "IDLE_FRACTION",
+    "LINK_MODE",
+    "MEMORY_ALLOCS",
+    "MEMORY_LIVE",
+    "MEMORY_NAME",
+    "MEMORY_PEAK",
+    "Q0",
+    "Q1",
+    "Q2",
+    "Q3",
+    "Q4",
+    "QUAT_DISAGREE_ERROR",
+    "QUAT_FORMAT",
+    "SINGULARITY_HALTING",
+    "SINGULARITY_OVERRIDE_ERROR",
+    "SINGULARITY_THOLD",
+    "SINGULARITY_TRIP",
+    "SM_MASTER_POWER",
+    "STACK_HIGH_WATER",
+    "TARGET_NUM",
+    "TASK_CALLS",
+    "TASK_EVENTS",
+    "TASK_EXEC_AVG",
+    "TASK_EXEC_MAX",
+    "TASK_EXEC_MIN",
+    "TASK_ID",
+    "TASK_JITTER_AVG",
+    "TASK_JITTER_MAX",
+    "TASK_NAME",
+    "TASK_OVERRUNS",
+    "TX_OVERFLOWS"
+};
+
+CString ON_LITERAL = "ON";
+CString OFF_LITERAL = "OFF";
+CString ON_OFF_SET[] = {ON_LITERAL, OFF_LITERAL};
+
+CString ACTIVE_LITERAL = "ACTIVE";
+CString INACTIVE_LITERAL = "INACTIVE";
+CString ACTIVE_INACTIVE_SET[] = {ACTIVE_LITERAL, INACTIVE_LITERAL};
+
+CString ASCII_LITERAL = "ASCII";
+CString BINARY_LITERAL = "BINARY";
+CString LINK_MODE_SET[] = {ASCII_LITERAL, BINARY_LITERAL};
+
+CString QUAT_FORMAT_SET[] = {KeywordLiterals[(int)Keyword::KW_Q0], KeywordLiterals[(int)Keyword::KW_Q4]};
+
+double NORM_RANGE[] = {0.0, 1.0};
+
+const KeywordParameter_t KeywordParameters[(int)Keyword::KEYWORD_COUNT] = {
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ON_OFF_SET},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ON_OFF_SET},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::DECIMAL, 0, NULL},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ON_OFF_SET},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ACTIVE_INACTIVE_SET},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)LINK_MODE_SET},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::STRING,  0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::RANGE, ParameterType::DECIMAL, 0, (void*)NORM_RANGE},
+    {ParameterDomain::RANGE, ParameterType::DECIMAL, 0, (void*)NORM_RANGE},
+    {ParameterDomain::RANGE, ParameterType::DECIMAL, 0, (void*)NORM_RANGE},
+    {ParameterDomain::RANGE, ParameterType::DECIMAL, 0, (void*)NORM_RANGE},
+    {ParameterDomain::RANGE, ParameterType::DECIMAL, 0, (void*)NORM_RANGE},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ON_OFF_SET},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)QUAT_FORMAT_SET},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ON_OFF_SET},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ON_OFF_SET},
+    {ParameterDomain::RANGE, ParameterType::DECIMAL, 0, (void*)NORM_RANGE},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ACTIVE_INACTIVE_SET},
+    {ParameterDomain::SET,   ParameterType::STRING,  2, (void*)ON_OFF_SET},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::STRING,  0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL},
+    {ParameterDomain::ANY,   ParameterType::INTEGER, 0, NULL}
+};
+
+} // end namespace Telecommunication
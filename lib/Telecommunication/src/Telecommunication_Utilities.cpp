@@ -16,7 +16,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "Telecommunication_CRC.hpp"
 #include "Telecommunication_Literals.hpp"
+#include "Telecommunication_Lookup.hpp"
 #include "Telecommunication_Types.hpp"
 namespace Telecommunication {
 
@@ -33,17 +35,7 @@ KeywordParameter_t GetKeywordParameter(Keyword keyword) {
 }
 
 Checksum crc32(CString data, StringSize length) {
-    Checksum crc = 0xFFFFFFFF;
-
-    for (StringSize i = 0; i < length; ++i) {
-        crc ^= data[i];
-        for (uint8_t j = 0; j < 8; j++) {
-            Checksum mask = -(crc & 1);
-            crc = (crc >> 1) ^ (0xEDB88320 & mask);
-        }
-    }
-
-    return crc;
+    return CRC::Update(CRC::INITIAL, (const uint8_t *)data, length);
 }
 
 namespace Decoding {
@@ -66,30 +58,80 @@ bool VerifyCommaDelimiter(char* &ptr) {
     return retval;
 }
 
-Command GetCommand(char* &ptr) {
-    Command retval = Command::NO_COMMAND;
-    for (int i = 0; i < (int)Command::COMMAND_COUNT; i++) {
-        StringSize length = strlen(CommandLiterals[i]);
-        if (strncmp(ptr, CommandLiterals[i], length) == 0) {
-            retval = (Command)i;
-            ptr += length;
-            break;
-        }
+namespace {
+
+inline bool IsTokenCharacter(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// Hashes the token in one pass, then compares the single candidate literal
+// at the token's exact length, so "SET" no longer matches "SET_POWER"
+int Find(const char *ptr, const Lookup::PerfectHash &hash, CString *literals, StringSize &length) {
+    uint16_t bucket = 0;
+    uint16_t slot = 0;
+    StringSize i = 0;
+    for (; IsTokenCharacter(ptr[i]); i++) {
+        bucket = (unsigned int)bucket * hash.bucket_multiplier + (uint8_t)ptr[i];
+        slot = (unsigned int)slot * hash.slot_multiplier + (uint8_t)ptr[i];
     }
-    return retval;
+
+    uint8_t displacement = pgm_read_byte(&hash.displacement[bucket & hash.bucket_mask]);
+    uint8_t index = pgm_read_byte(&hash.slots[(slot ^ displacement) & hash.slot_mask]);
+    if (index == Lookup::EMPTY) return -1;
+    if (strncmp(ptr, literals[index], i) != 0 || literals[index][i] != '\0') return -1;
+
+    length = i;
+    return index;
+}
+
+} // end namespace
+
+Command GetCommand(char* &ptr) {
+    StringSize length;
+    int index = Find(ptr, Lookup::COMMAND_HASH, CommandLiterals, length);
+    if (index < 0) return Command::NO_COMMAND;
+    ptr += length;
+    return (Command)index;
 }
 
 Keyword GetKeyword(char* &ptr) {
-    Keyword retval = Keyword::NO_KEYWORD;
-    for (int i = 0; i < (int)Keyword::KEYWORD_COUNT; i++) {
-        StringSize length = strlen(KeywordLiterals[i]);
-        if (strncmp(ptr, KeywordLiterals[i], length) == 0) {
-            retval = (Keyword)i;
-            ptr += length;
-            break;
-        }
+    StringSize length;
+    int index = Find(ptr, Lookup::KEYWORD_HASH, KeywordLiterals, length);
+    if (index < 0) return Keyword::NO_KEYWORD;
+    ptr += length;
+    return (Keyword)index;
+}
+
+bool InDomain(const KeywordParameter_t &parameter, long int value) {
+    switch (parameter.domain) {
+        case ParameterDomain::SET:
+            for (StringSize i = 0; i < parameter.length; i++) {
+                if (value == parameter.integer[i]) return true;
+            }
+            return false;
+        case ParameterDomain::RANGE:
+            return value >= parameter.integer[0] && value <= parameter.integer[1];
+        case ParameterDomain::ANY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool InDomain(const KeywordParameter_t &parameter, double value) {
+    switch (parameter.domain) {
+        case ParameterDomain::SET:
+            for (StringSize i = 0; i < parameter.length; i++) {
+                if (value == parameter.decimal[i]) return true;
+            }
+            return false;
+        case ParameterDomain::RANGE:
+            return value >= parameter.decimal[0] && value <= parameter.decimal[1];
+        case ParameterDomain::ANY:
+            return true;
+        default:
+            return false;
     }
-    return retval;
 }
 
 } // namespace Decoding
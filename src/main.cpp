@@ -1,6 +1,9 @@
-#include <Arduino.h>
+#include <Platform.hpp>
 
 #include <CORALS.hpp>
+#include <CORALS_Configuration.hpp>
+
+#ifdef ARDUINO
 
 void setup() {
     CORALS::initialize();
@@ -8,4 +11,45 @@ void setup() {
 
 void loop() {
     CORALS::run();
-}
\ No newline at end of file
+}
+
+// Called by the Arduino core between loop() passes while Serial1 has data
+void serialEvent1() {
+    CORALS::signal(CORALS_EVENT_TELECOM_RX);
+}
+
+#else
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+
+// Usage: corals_host [simulated hours] [binary log capture]
+int main(int argc, char **argv) {
+    double hours = (argc > 1) ? atof(argv[1]) : 1.0;
+    FILE *log_capture = (argc > 2) ? fopen(argv[2], "wb") : NULL;
+
+    Platform::Host::DebugConsole.SetOutput(log_capture);
+    Platform::Host::TelecomConsole.SetOutput(stdout);
+
+    CORALS::initialize();
+
+    const uint64_t end_us = hours * 3600.0 * 1000000.0;
+    unsigned long long iterations = 0;
+    auto wall_start = std::chrono::steady_clock::now();
+    while (Platform::Clock::Now() < end_us) {
+        CORALS::run();
+        if (PLATFORM_TELECOM_CONSOLE.available()) CORALS::signal(CORALS_EVENT_TELECOM_RX);
+        Platform::Clock::Advance(PLATFORM_HOST_LOOP_US);
+        iterations++;
+    }
+    double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+
+    fprintf(stderr, "Simulated %.2f h in %.2f s (%llu loop iterations)\n", hours, wall_s, iterations);
+
+    if (log_capture != NULL) fclose(log_capture);
+    return 0;
+}
+
+#endif
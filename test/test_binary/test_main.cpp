@@ -0,0 +1,225 @@
+/**
+ ********************************************************************************
+ * @file    test_main.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Binary Telecom Framing (COBS) Round-Trip Tests
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <unity.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <Telecommunication_Binary.hpp>
+#include <Telecommunication_CRC.hpp>
+#include <Telecommunication_Literals.hpp>
+#include <Telecommunication_Types.hpp>
+
+using namespace Telecommunication;
+
+namespace {
+
+const StringSize FRAME_CAPACITY = 300;
+const uint8_t PAIR_CAPACITY = 8;
+
+// Straightforward COBS, to check the streaming encoder against
+StringSize ReferenceCobs(const uint8_t *input, StringSize length, uint8_t *output) {
+    StringSize code_index = 0;
+    StringSize out = 1;
+    uint8_t code = 1;
+    for (StringSize i = 0; i < length; i++) {
+        if (input[i] == 0) {
+            output[code_index] = code;
+            code_index = out++;
+            code = 1;
+            continue;
+        }
+        output[out++] = input[i];
+        if (++code == 0xFF) {
+            output[code_index] = code;
+            code_index = out++;
+            code = 1;
+        }
+    }
+    output[code_index] = code;
+    return out;
+}
+
+// Payload of a TR_CORALS_STATE frame with one free string of the given length
+StringSize StringPayload(StringSize string_length, uint8_t *payload) {
+    StringSize length = 0;
+    payload[length++] = (uint8_t)Command::TR_CORALS_STATE;
+    payload[length++] = (uint8_t)Keyword::KW_TASK_NAME;
+    payload[length++] = string_length;
+    for (StringSize i = 0; i < string_length; i++) payload[length++] = 'a' + i % 26;
+
+    Checksum checksum = CRC::Update(CRC::INITIAL, payload, length);
+    for (uint8_t i = 0; i < 4; i++) payload[length++] = checksum >> (8 * i);
+    return length;
+}
+
+StringSize EncodeString(StringSize string_length, uint8_t *frame, StringSize capacity) {
+    char string[256];
+    for (StringSize i = 0; i < string_length; i++) string[i] = 'a' + i % 26;
+    string[string_length] = '\0';
+
+    KeyValue key_value;
+    key_value.keyword = Keyword::KW_TASK_NAME;
+    key_value.type = ParameterType::STRING;
+    key_value.value.string = string;
+
+    TeleMessage message;
+    message.command = Command::TR_CORALS_STATE;
+    message.key_value_pairs = &key_value;
+    message.pair_count = 1;
+    return Binary::Encode(message, frame, capacity);
+}
+
+} // end namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_message_round_trip() {
+    KeyValue pairs[3];
+    pairs[0].keyword = Keyword::KW_TARGET_NUM;
+    pairs[0].type = ParameterType::INTEGER;
+    pairs[0].value.integer = -42;
+    pairs[1].keyword = Keyword::KW_GAIN11;
+    pairs[1].type = ParameterType::DECIMAL;
+    pairs[1].value.decimal = 0.125;
+    pairs[2].keyword = Keyword::KW_LINK_MODE;
+    pairs[2].type = ParameterType::STRING;
+    pairs[2].value.string = (String)BINARY_LITERAL;
+
+    TeleMessage message;
+    message.command = Command::TC_ECHO;
+    message.key_value_pairs = pairs;
+    message.pair_count = 3;
+
+    uint8_t frame[FRAME_CAPACITY];
+    StringSize length = Binary::Encode(message, frame, sizeof(frame));
+    TEST_ASSERT_TRUE(length > 0);
+    for (StringSize i = 0; i < length; i++) TEST_ASSERT_NOT_EQUAL(Binary::DELIMITER, frame[i]);
+
+    KeyValue decoded[PAIR_CAPACITY];
+    TeleMessage result = Binary::Decode(frame, length, decoded, PAIR_CAPACITY);
+    TEST_ASSERT_TRUE(result.valid);
+    TEST_ASSERT_EQUAL_INT((int)Command::TC_ECHO, (int)result.command);
+    TEST_ASSERT_EQUAL_UINT(3, result.pair_count);
+    TEST_ASSERT_EQUAL_INT(-42, decoded[0].value.integer);
+    TEST_ASSERT_TRUE(fabs(decoded[1].value.decimal - 0.125) < 1e-9);
+    TEST_ASSERT_TRUE(decoded[2].value.string == BINARY_LITERAL);
+}
+
+void test_cobs_runs_around_254_bytes() {
+    // Payloads from well under to well over one 254-byte COBS block
+    for (StringSize string_length = 240; string_length <= 255; string_length++) {
+        uint8_t payload[FRAME_CAPACITY];
+        StringSize payload_length = StringPayload(string_length, payload);
+
+        uint8_t expected[FRAME_CAPACITY];
+        StringSize expected_length = ReferenceCobs(payload, payload_length, expected);
+
+        uint8_t frame[FRAME_CAPACITY];
+        StringSize length = EncodeString(string_length, frame, sizeof(frame));
+        TEST_ASSERT_EQUAL_UINT(expected_length, length);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, frame, length);
+        for (StringSize i = 0; i < length; i++) TEST_ASSERT_NOT_EQUAL(Binary::DELIMITER, frame[i]);
+
+        TEST_ASSERT_EQUAL_UINT(payload_length, Binary::CobsDecode(frame, length));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, frame, payload_length);
+    }
+}
+
+void test_cobs_exact_block() {
+    // 254 non-zero bytes fill one block exactly and need no trailing zero
+    uint8_t payload[254];
+    memset(payload, 0x5A, sizeof(payload));
+
+    uint8_t frame[FRAME_CAPACITY];
+    StringSize length = ReferenceCobs(payload, sizeof(payload), frame);
+    TEST_ASSERT_EQUAL_UINT(256, length);
+    TEST_ASSERT_EQUAL_UINT8(0xFF, frame[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x01, frame[255]);
+
+    TEST_ASSERT_EQUAL_UINT(sizeof(payload), Binary::CobsDecode(frame, length));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, frame, sizeof(payload));
+}
+
+void test_encode_rejects_small_buffer() {
+    uint8_t frame[FRAME_CAPACITY];
+    StringSize length = EncodeString(255, frame, sizeof(frame));
+    TEST_ASSERT_TRUE(length > 0);
+
+    uint8_t exact[FRAME_CAPACITY];
+    TEST_ASSERT_EQUAL_UINT(length, EncodeString(255, exact, length));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(frame, exact, length);
+    TEST_ASSERT_EQUAL_UINT(0, EncodeString(255, exact, length - 1));
+}
+
+void test_truncated_frames_are_rejected() {
+    KeyValue pairs[2];
+    pairs[0].keyword = Keyword::KW_TARGET_NUM;
+    pairs[0].type = ParameterType::INTEGER;
+    pairs[0].value.integer = 7;
+    pairs[1].keyword = Keyword::KW_LINK_MODE;
+    pairs[1].type = ParameterType::STRING;
+    pairs[1].value.string = (String)ASCII_LITERAL;
+
+    TeleMessage message;
+    message.command = Command::TC_SET_LINK;
+    message.key_value_pairs = pairs;
+    message.pair_count = 2;
+
+    uint8_t frame[FRAME_CAPACITY];
+    StringSize length = Binary::Encode(message, frame, sizeof(frame));
+    TEST_ASSERT_TRUE(length > 0);
+
+    for (StringSize truncated = 0; truncated < length; truncated++) {
+        uint8_t copy[FRAME_CAPACITY];
+        memcpy(copy, frame, truncated);
+        KeyValue decoded[PAIR_CAPACITY];
+        TEST_ASSERT_FALSE(Binary::Decode(copy, truncated, decoded, PAIR_CAPACITY).valid);
+    }
+}
+
+void test_frame_ending_on_set_keyword_is_rejected() {
+    // A correct checksum over a SET keyword with no index byte after it
+    uint8_t payload[8];
+    StringSize length = 0;
+    payload[length++] = (uint8_t)Command::TC_SET_LINK;
+    payload[length++] = (uint8_t)Keyword::KW_LINK_MODE;
+    Checksum checksum = CRC::Update(CRC::INITIAL, payload, length);
+    for (uint8_t i = 0; i < 4; i++) payload[length++] = checksum >> (8 * i);
+
+    uint8_t frame[16];
+    StringSize frame_length = ReferenceCobs(payload, length, frame);
+    KeyValue decoded[PAIR_CAPACITY];
+    TEST_ASSERT_FALSE(Binary::Decode(frame, frame_length, decoded, PAIR_CAPACITY).valid);
+}
+
+void test_malformed_cobs_is_rejected() {
+    uint8_t overlong[] = {0x05, 0x01, 0x02};
+    TEST_ASSERT_EQUAL_UINT(0, Binary::CobsDecode(overlong, sizeof(overlong)));
+
+    uint8_t zero_code[] = {0x02, 0x01, 0x00, 0x01};
+    TEST_ASSERT_EQUAL_UINT(0, Binary::CobsDecode(zero_code, sizeof(zero_code)));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_message_round_trip);
+    RUN_TEST(test_cobs_runs_around_254_bytes);
+    RUN_TEST(test_cobs_exact_block);
+    RUN_TEST(test_encode_rejects_small_buffer);
+    RUN_TEST(test_truncated_frames_are_rejected);
+    RUN_TEST(test_frame_ending_on_set_keyword_is_rejected);
+    RUN_TEST(test_malformed_cobs_is_rejected);
+    return UNITY_END();
+}
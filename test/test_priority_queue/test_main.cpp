@@ -0,0 +1,144 @@
+/**
+ ********************************************************************************
+ * @file    test_main.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   PriorityQueue Handle Update and Erase Tests
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <unity.h>
+
+#include <PriorityQueue.tpp>
+
+using namespace DataStructures;
+
+namespace {
+
+const PriorityQueueSize_t CAPACITY = 8;
+
+struct Ascending {
+    bool operator()(int a, int b) const { return a < b; }
+};
+
+typedef PriorityQueue<int, Ascending, CAPACITY> Queue;
+
+void PopAll(Queue &queue, int *values, PriorityQueueSize_t &count) {
+    count = 0;
+    while (!queue.empty()) values[count++] = queue.pop();
+}
+
+void AssertOrder(Queue &queue, const int *expected, PriorityQueueSize_t count) {
+    int values[CAPACITY];
+    PriorityQueueSize_t popped;
+    PopAll(queue, values, popped);
+    TEST_ASSERT_EQUAL_UINT(count, popped);
+    for (PriorityQueueSize_t i = 0; i < count; i++) TEST_ASSERT_EQUAL_INT(expected[i], values[i]);
+}
+
+} // end namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_update_moves_element_up() {
+    Queue queue;
+    queue.push(10);
+    queue.push(20);
+    PriorityQueueHandle_t handle = queue.push(30);
+    queue.push(40);
+
+    TEST_ASSERT_TRUE(queue.update(handle, 5));
+    TEST_ASSERT_EQUAL_UINT(handle, queue.top_handle());
+
+    const int expected[] = {5, 10, 20, 40};
+    AssertOrder(queue, expected, 4);
+}
+
+void test_update_moves_element_down() {
+    Queue queue;
+    PriorityQueueHandle_t handle = queue.push(10);
+    queue.push(20);
+    queue.push(30);
+    queue.push(40);
+
+    queue.get(handle) = 35;
+    TEST_ASSERT_TRUE(queue.update(handle));
+    TEST_ASSERT_EQUAL_INT(20, queue.top());
+
+    const int expected[] = {20, 30, 35, 40};
+    AssertOrder(queue, expected, 4);
+}
+
+void test_handle_follows_element_through_sifts() {
+    Queue queue;
+    PriorityQueueHandle_t handles[CAPACITY];
+    for (PriorityQueueSize_t i = 0; i < CAPACITY; i++) handles[i] = queue.push((int)(CAPACITY - i) * 10);
+
+    // Reverse the order twice over; every handle must still reach its own value
+    for (PriorityQueueSize_t i = 0; i < CAPACITY; i++) TEST_ASSERT_TRUE(queue.update(handles[i], (int)i));
+    for (PriorityQueueSize_t i = 0; i < CAPACITY; i++) TEST_ASSERT_EQUAL_INT((int)i, queue.get(handles[i]));
+    TEST_ASSERT_EQUAL_UINT(handles[0], queue.top_handle());
+}
+
+void test_erase_top_middle_and_last() {
+    Queue queue;
+    PriorityQueueHandle_t first = queue.push(10);
+    PriorityQueueHandle_t middle = queue.push(30);
+    queue.push(20);
+    queue.push(50);
+    PriorityQueueHandle_t last = queue.push(40);
+
+    TEST_ASSERT_TRUE(queue.erase(middle));
+    TEST_ASSERT_TRUE(queue.erase(first));
+    TEST_ASSERT_TRUE(queue.erase(last));
+    TEST_ASSERT_EQUAL_UINT(2, queue.size());
+
+    const int expected[] = {20, 50};
+    AssertOrder(queue, expected, 2);
+}
+
+void test_erased_handle_is_rejected() {
+    Queue queue;
+    PriorityQueueHandle_t handle = queue.push(10);
+    queue.push(20);
+
+    TEST_ASSERT_TRUE(queue.erase(handle));
+    TEST_ASSERT_FALSE(queue.contains(handle));
+    TEST_ASSERT_FALSE(queue.erase(handle));
+    TEST_ASSERT_FALSE(queue.update(handle, 1));
+    TEST_ASSERT_FALSE(queue.erase(PRIORITY_QUEUE_INVALID));
+    TEST_ASSERT_FALSE(queue.update(CAPACITY));
+    TEST_ASSERT_EQUAL_UINT(1, queue.size());
+}
+
+void test_erase_frees_slot_for_reuse() {
+    Queue queue;
+    PriorityQueueHandle_t handles[CAPACITY];
+    for (PriorityQueueSize_t i = 0; i < CAPACITY; i++) handles[i] = queue.push((int)i);
+    TEST_ASSERT_TRUE(queue.full());
+    TEST_ASSERT_EQUAL_UINT(PRIORITY_QUEUE_INVALID, queue.push(100));
+    TEST_ASSERT_EQUAL_UINT(1, queue.overflows());
+
+    TEST_ASSERT_TRUE(queue.erase(handles[3]));
+    PriorityQueueHandle_t reused = queue.push(-1);
+    TEST_ASSERT_EQUAL_UINT(handles[3], reused);
+    TEST_ASSERT_EQUAL_INT(-1, queue.top());
+
+    const int expected[] = {-1, 0, 1, 2, 4, 5, 6, 7};
+    AssertOrder(queue, expected, CAPACITY);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_update_moves_element_up);
+    RUN_TEST(test_update_moves_element_down);
+    RUN_TEST(test_handle_follows_element_through_sifts);
+    RUN_TEST(test_erase_top_middle_and_last);
+    RUN_TEST(test_erased_handle_is_rejected);
+    RUN_TEST(test_erase_frees_slot_for_reuse);
+    return UNITY_END();
+}
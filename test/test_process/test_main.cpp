@@ -0,0 +1,99 @@
+/**
+ ********************************************************************************
+ * @file    test_main.cpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Budgeted Process Execution Estimate Tests
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+#include <unity.h>
+
+#include <Platform.hpp>
+#include <StateManager_Process.hpp>
+
+using namespace StateManager;
+
+namespace {
+
+const SM_Time BUDGET_US = 2000;
+const SM_Time COST_US = 100;
+const SM_Time SPIKE_US = 5000;
+const SM_Time SLOT_US = 1000;
+
+unsigned int Calls = 0;
+unsigned int Spikes = 0;
+
+void Fast() {
+    Calls++;
+    Platform::Clock::Advance(COST_US);
+}
+
+// Stands in for a member that now and then blocks, like a transmit on a slow link
+void Slow() {
+    Calls++;
+    if (Spikes > 0) {
+        Spikes--;
+        Platform::Clock::Advance(SPIKE_US);
+    }
+    else {
+        Platform::Clock::Advance(COST_US);
+    }
+}
+
+void RegisterMembers(Process &process) {
+    process.Register("fast", Fast);
+    process.Register("slow_a", Slow);
+    process.Register("slow_b", Slow);
+}
+
+// Runs the process in one scheduler slot and counts the members it called
+unsigned int RunSlot(Process &process) {
+    Calls = 0;
+    process.Run();
+    Platform::Clock::Advance(SLOT_US);
+    return Calls;
+}
+
+} // end namespace
+
+void setUp(void) {
+    Platform::Clock::SetMode(Platform::Clock::ClockMode::VIRTUAL);
+    Platform::Clock::Set(0);
+    Spikes = 0;
+}
+
+void tearDown(void) {}
+
+void test_all_members_fit_the_budget() {
+    Process process(BUDGET_US);
+    RegisterMembers(process);
+
+    for (int i = 0; i < 8; i++) TEST_ASSERT_EQUAL_UINT(3, RunSlot(process));
+}
+
+void test_spikes_wear_off() {
+    Process process(BUDGET_US);
+    RegisterMembers(process);
+    RunSlot(process);
+
+    // One call each far over the budget holds both slow members back for a while
+    Spikes = 2;
+    while (Spikes > 0) RunSlot(process);
+
+    unsigned int slots = 0;
+    while (RunSlot(process) < 3) TEST_ASSERT_TRUE(++slots < 32);
+
+    // Normal calls have brought the estimates down, so every slot runs every member again
+    for (int i = 0; i < 8; i++) TEST_ASSERT_EQUAL_UINT(3, RunSlot(process));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_all_members_fit_the_budget);
+    RUN_TEST(test_spikes_wear_off);
+    return UNITY_END();
+}
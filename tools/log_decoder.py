@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Decode CORALS binary log records into text.
+
+Records are read from a capture file or a serial port and looked up in the
+message catalog (lib/Logging/include/Logging_Messages.hpp), so the catalog
+must match the firmware that produced the log.
+
+    python3 tools/log_decoder.py capture.bin
+    python3 tools/log_decoder.py --serial /dev/ttyACM0 --baud 115200
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+SYNC_BYTE = 0xA5
+HEADER = struct.Struct("<BBBBI")
+LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG", 5: "TRACE"}
+DEFAULT_CATALOG = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               "..", "lib", "Logging", "include", "Logging_Messages.hpp")
+
+
+def load_catalog(path):
+    with open(path) as catalog:
+        text = catalog.read()
+    entries = re.findall(r'MESSAGE\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', text)
+    # printf length modifiers have no meaning to Python's % operator
+    return [(name, re.sub(r"%l+([udx])", r"%\1", fmt)) for name, fmt in entries]
+
+
+def read_records(stream, live=False):
+    # A serial read that times out is empty too, so a live port only ends on interrupt
+    buffer = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if live:
+                continue
+            return
+        buffer.extend(chunk)
+        while True:
+            start = buffer.find(bytes([SYNC_BYTE]))
+            if start < 0:
+                buffer.clear()
+                break
+            del buffer[:start]
+            if len(buffer) < HEADER.size:
+                break
+            _, message, level, argc, timestamp = HEADER.unpack_from(buffer)
+            length = HEADER.size + 4 * argc
+            if len(buffer) < length:
+                break
+            arguments = struct.unpack_from("<%di" % argc, buffer, HEADER.size)
+            del buffer[:length]
+            yield timestamp, message, level, arguments
+
+
+def format_record(catalog, timestamp, message, level, arguments):
+    if message < len(catalog):
+        name, fmt = catalog[message]
+        try:
+            text = fmt % arguments
+        except (TypeError, ValueError):
+            text = "%s %s" % (name, arguments)
+    else:
+        text = "UNKNOWN_MESSAGE_%d %s" % (message, arguments)
+    return "[%10u] %-7s %s" % (timestamp, LEVELS.get(level, str(level)), text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="binary capture file (default: stdin)")
+    parser.add_argument("--serial", help="read from a serial port instead (requires pyserial)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--catalog", default=DEFAULT_CATALOG)
+    args = parser.parse_args()
+
+    catalog = load_catalog(args.catalog)
+
+    if args.serial:
+        import serial
+        stream = serial.Serial(args.serial, args.baud, timeout=1)
+    elif args.capture:
+        stream = open(args.capture, "rb")
+    else:
+        stream = sys.stdin.buffer
+
+    try:
+        for record in read_records(stream, live=bool(args.serial)):
+            print(format_record(catalog, *record), flush=True)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
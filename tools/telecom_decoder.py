@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""
+Decode CORALS binary telecom frames into their ASCII form.
+
+This is the ground-side reference for the BINARY link mode. Frames are read
+from a capture file, a serial port or hex on the command line, and the
+command, keyword and set tables come from Telecommunication_Literals.cpp, so
+they must match the firmware that sent the frames. Free strings such as
+TASK_NAME and MEMORY_NAME, which the firmware's own decoder refuses, are
+decoded here.
+
+    python3 tools/telecom_decoder.py capture.bin
+    python3 tools/telecom_decoder.py --serial /dev/ttyACM0 --baud 9600
+    python3 tools/telecom_decoder.py --hex "0B 2E 01 ..."
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+from telecom_lookup_gen import DEFAULT_LITERALS, load_literals
+
+DELIMITER = 0x00
+DESTINATION = "DARTS"
+CHECKSUM_BYTES = 4
+
+
+class FrameError(Exception):
+    pass
+
+
+def load_parameters(path, keywords):
+    with open(path) as source:
+        text = source.read()
+    literals = dict(re.findall(r'CString\s+(\w+)\s*=\s*"([^"]*)"\s*;', text))
+    sets = {}
+    for name, body in re.findall(r"CString\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};", text, re.S):
+        members = []
+        for member in (m.strip() for m in body.split(",")):
+            keyword = re.match(r"KeywordLiterals\s*\[\s*\(int\)\s*Keyword::KW_(\w+)\s*\]", member)
+            members.append(keyword.group(1) if keyword else literals[member])
+        sets[name] = members
+
+    match = re.search(r"KeywordParameters\s*\[[^\]]*\]\s*=\s*\{(.*)\};", text, re.S)
+    rows = re.findall(r"\{\s*ParameterDomain::(\w+)\s*,\s*ParameterType::(\w+)\s*,\s*\d+\s*,\s*(?:\(void\s*\*\))?\s*(\w+)\s*\}",
+                      match.group(1))
+    if len(rows) != len(keywords):
+        sys.exit("KeywordParameters has %d rows for %d keywords" % (len(rows), len(keywords)))
+    return [(datatype, sets.get(values) if domain == "SET" else None) for domain, datatype, values in rows]
+
+
+def crc32(data):
+    # The firmware CRC starts at 0xFFFFFFFF and has no final XOR
+    return zlib.crc32(data) ^ 0xFFFFFFFF
+
+
+def cobs_decode(frame):
+    output = bytearray()
+    index = 0
+    while index < len(frame):
+        code = frame[index]
+        index += 1
+        if code == 0 or index + code - 1 > len(frame):
+            raise FrameError("malformed COBS encoding")
+        output.extend(frame[index:index + code - 1])
+        index += code - 1
+        if code < 0xFF and index < len(frame):
+            output.append(0)
+    return bytes(output)
+
+
+def decode(frame, commands, keywords, parameters):
+    payload = cobs_decode(frame)
+    if len(payload) < 1 + CHECKSUM_BYTES:
+        raise FrameError("frame too short")
+    body, checksum = payload[:-CHECKSUM_BYTES], struct.unpack("<I", payload[-CHECKSUM_BYTES:])[0]
+    if crc32(body) != checksum:
+        raise FrameError("checksum mismatch")
+    if body[0] >= len(commands):
+        raise FrameError("unknown command %d" % body[0])
+
+    pairs = []
+    index = 1
+    while index < len(body):
+        keyword = body[index]
+        index += 1
+        if keyword >= len(keywords):
+            raise FrameError("unknown keyword %d" % keyword)
+        datatype, members = parameters[keyword]
+        if datatype in ("INTEGER", "DECIMAL"):
+            if len(body) - index < 4:
+                raise FrameError("truncated %s" % keywords[keyword])
+            value = struct.unpack_from("<i" if datatype == "INTEGER" else "<f", body, index)[0]
+            text = "%d" % value if datatype == "INTEGER" else "%.6f" % value
+            index += 4
+        elif members is not None:
+            if index >= len(body) or body[index] >= len(members):
+                raise FrameError("bad set index for %s" % keywords[keyword])
+            text = members[body[index]]
+            index += 1
+        else:
+            if index >= len(body) or len(body) - index - 1 < body[index]:
+                raise FrameError("truncated %s" % keywords[keyword])
+            length = body[index]
+            text = body[index + 1:index + 1 + length].decode("ascii", "replace")
+            index += 1 + length
+        pairs.append("%s %s" % (keywords[keyword], text))
+
+    message = "%s . %s" % (DESTINATION, commands[body[0]])
+    if pairs:
+        message += ", " + ", ".join(pairs)
+    return "%s . CRC32 0x%08X" % (message, checksum)
+
+
+def read_frames(stream, live=False):
+    # A serial read that times out is empty too, so a live port only ends on interrupt
+    buffer = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if live:
+                continue
+            if buffer:
+                yield bytes(buffer)
+            return
+        buffer.extend(chunk)
+        while True:
+            end = buffer.find(bytes([DELIMITER]))
+            if end < 0:
+                break
+            frame = bytes(buffer[:end])
+            del buffer[:end + 1]
+            if frame:
+                yield frame
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="binary capture file (default: stdin)")
+    parser.add_argument("--serial", help="read from a serial port instead (requires pyserial)")
+    parser.add_argument("--baud", type=int, default=9600)
+    parser.add_argument("--hex", help="decode one frame given as hex, without the delimiter")
+    parser.add_argument("--literals", default=DEFAULT_LITERALS)
+    args = parser.parse_args()
+
+    commands = load_literals(args.literals, "CommandLiterals")
+    keywords = load_literals(args.literals, "KeywordLiterals")
+    parameters = load_parameters(args.literals, keywords)
+
+    if args.hex:
+        frames = [bytes.fromhex(args.hex)]
+    elif args.serial:
+        import serial
+        frames = read_frames(serial.Serial(args.serial, args.baud, timeout=1), live=True)
+    elif args.capture:
+        frames = read_frames(open(args.capture, "rb"))
+    else:
+        frames = read_frames(sys.stdin.buffer)
+
+    try:
+        for frame in frames:
+            try:
+                print(decode(frame, commands, keywords, parameters), flush=True)
+            except FrameError as error:
+                print("INVALID (%s) %s" % (error, frame.hex()), flush=True)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""
+Generate the perfect-hash tables used to decode telecom commands and keywords.
+
+Reads CommandLiterals and KeywordLiterals from Telecommunication_Literals.cpp
+and writes Telecommunication_Lookup.hpp. Rerun it whenever a literal is added,
+removed or reordered:
+
+    python3 tools/telecom_lookup_gen.py
+
+A token hashes in one pass over its bytes into two 16-bit values. The first
+picks a bucket whose displacement is XORed into the second to give the slot,
+and the slot names the one literal the token can be, which is then compared
+at its exact length.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "lib", "Telecommunication")
+DEFAULT_LITERALS = os.path.join(ROOT, "src", "Telecommunication_Literals.cpp")
+DEFAULT_OUTPUT = os.path.join(ROOT, "include", "Telecommunication_Lookup.hpp")
+
+TOKEN = re.compile(r"^[A-Z0-9_]+$")
+MULTIPLIERS = [31, 33, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 131, 257, 33013]
+EMPTY = 0xFF
+
+
+def load_literals(path, name):
+    with open(path) as source:
+        text = source.read()
+    match = re.search(r"CString\s+%s\s*\[[^\]]*\]\s*=\s*\{(.*?)\};" % name, text, re.S)
+    if match is None:
+        sys.exit("%s not found in %s" % (name, path))
+    literals = re.findall(r'"([^"]*)"', match.group(1))
+    for literal in literals:
+        if not TOKEN.match(literal):
+            sys.exit("%s: %r uses characters outside [A-Z0-9_]" % (name, literal))
+    if len(set(literals)) != len(literals):
+        sys.exit("%s contains duplicate literals" % name)
+    return literals
+
+
+def token_hash(token, multiplier):
+    value = 0
+    for character in token.encode():
+        value = (value * multiplier + character) & 0xFFFF
+    return value
+
+
+def place(literals, bucket_multiplier, slot_multiplier, bucket_count, slot_count):
+    buckets = [[] for _ in range(bucket_count)]
+    for index, literal in enumerate(literals):
+        buckets[token_hash(literal, bucket_multiplier) & (bucket_count - 1)].append(index)
+
+    slots = [EMPTY] * slot_count
+    displacements = [0] * bucket_count
+    # Largest buckets first, while the table still has room to spare
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        members = buckets[bucket]
+        if not members:
+            continue
+        hashes = [token_hash(literals[index], slot_multiplier) for index in members]
+        for displacement in range(256):
+            targets = [(h ^ displacement) & (slot_count - 1) for h in hashes]
+            if len(set(targets)) == len(targets) and all(slots[t] == EMPTY for t in targets):
+                for index, target in zip(members, targets):
+                    slots[target] = index
+                displacements[bucket] = displacement
+                break
+        else:
+            return None
+    return displacements, slots
+
+
+def build(literals):
+    slot_count = 1
+    while slot_count < len(literals):
+        slot_count *= 2
+    while slot_count <= 256:
+        for bucket_count in (slot_count // 4, slot_count // 2, slot_count):
+            for bucket_multiplier in MULTIPLIERS:
+                for slot_multiplier in MULTIPLIERS:
+                    if slot_multiplier == bucket_multiplier:
+                        continue
+                    placed = place(literals, bucket_multiplier, slot_multiplier, bucket_count, slot_count)
+                    if placed is not None:
+                        return bucket_multiplier, slot_multiplier, placed[0], placed[1]
+        slot_count *= 2
+    sys.exit("no perfect hash found for %d literals" % len(literals))
+
+
+def format_array(values, per_line=16):
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append("    " + ", ".join("0x%02X" % v for v in values[start:start + per_line]))
+    return ",\n".join(lines)
+
+
+def emit_table(name, literals, count_expression):
+    bucket_multiplier, slot_multiplier, displacements, slots = build(literals)
+    return """// %(count)d literals, %(slots)d slots, %(buckets)d buckets
+const uint8_t %(name)s_DISPLACEMENT[%(buckets)d] PROGMEM = {
+%(displacement)s
+};
+
+const uint8_t %(name)s_SLOTS[%(slots)d] PROGMEM = {
+%(slot_values)s
+};
+
+const PerfectHash %(name)s_HASH = {%(bucket_multiplier)d, %(slot_multiplier)d, %(bucket_mask)d, %(slot_mask)d, %(name)s_DISPLACEMENT, %(name)s_SLOTS};
+
+static_assert(%(count_expression)s == %(count)d, "%(name)s tables are stale; rerun tools/telecom_lookup_gen.py");
+""" % {
+        "name": name,
+        "count": len(literals),
+        "count_expression": count_expression,
+        "buckets": len(displacements),
+        "slots": len(slots),
+        "displacement": format_array(displacements),
+        "slot_values": format_array(slots),
+        "bucket_multiplier": bucket_multiplier,
+        "slot_multiplier": slot_multiplier,
+        "bucket_mask": len(displacements) - 1,
+        "slot_mask": len(slots) - 1,
+    }
+
+
+HEADER = """/**
+ ********************************************************************************
+ * @file    Telecommunication_Lookup.hpp
+ * @author  Logan Ruddick (Logan@Ruddicks.net)
+ * @brief   Perfect-Hash Tables for Command and Keyword Decoding
+ * @version 1.0
+ * @date    2026-10-16
+ ********************************************************************************
+ * @copyright Copyright (c) 2024
+ ********************************************************************************
+**/
+
+// Generated by tools/telecom_lookup_gen.py from Telecommunication_Literals.cpp.
+// Do not edit by hand.
+
+#ifndef __TELECOMMUNICATION_LOOKUP_HPP__
+#define __TELECOMMUNICATION_LOOKUP_HPP__
+
+#include <stdint.h>
+
+#include <Platform.hpp>
+
+#include "Telecommunication_Types.hpp"
+
+namespace Telecommunication {
+
+namespace Lookup {
+
+const uint8_t EMPTY = 0x%(empty)02X;
+
+// h = h * multiplier + byte over the token, in 16 bits. The bucket hash picks
+// a displacement that is XORed into the slot hash.
+struct PerfectHash {
+    uint16_t bucket_multiplier;
+    uint16_t slot_multiplier;
+    uint8_t bucket_mask;
+    uint8_t slot_mask;
+    const uint8_t *displacement;
+    const uint8_t *slots;
+};
+
+%(commands)s
+%(keywords)s
+} // end namespace Lookup
+
+} // end namespace Telecommunication
+
+#endif // __TELECOMMUNICATION_LOOKUP_HPP__
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--literals", default=DEFAULT_LITERALS)
+    parser.add_argument("--output", default=DEFAULT_OUTPUT)
+    arguments = parser.parse_args()
+
+    commands = load_literals(arguments.literals, "CommandLiterals")
+    keywords = load_literals(arguments.literals, "KeywordLiterals")
+
+    with open(arguments.output, "w") as output:
+        output.write(HEADER % {
+            "empty": EMPTY,
+            "commands": emit_table("COMMAND", commands, "(int)Command::COMMAND_COUNT"),
+            "keywords": emit_table("KEYWORD", keywords, "(int)Keyword::KEYWORD_COUNT"),
+        })
+
+
+if __name__ == "__main__":
+    main()